@@ -0,0 +1,296 @@
+/*******************************************************************************
+ * @file  deque_bench.c
+ *
+ * @brief Throughput benchmarks for the core deque
+ *
+ * @details Runs each access pattern for every data size, fill level and
+ *          cursor mode, keeps the best of a few repeats and prints one row
+ *          per run, as CSV by default or as JSON with --json:
+ *
+ *              benchmark,mode,data_size,fill_pct,ops,ns_per_op,ops_per_sec
+ *
+ *          Built with DEQUE_INSTRUMENT, the per-operation latency percentiles
+ *          of the whole run are printed to stderr afterwards.
+ *
+ *          Normally built and run with `rake bench:run`, or by hand with e.g.
+ *          gcc -O2 -Isrc src/deque.c src/deque_instr.c bench/deque_bench.c
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "deque.h"
+#include "deque_instr.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#define BENCH_SLOTS        1024U      /* Capacity in elements, a power of 2 */
+#define BENCH_MAX_DATA     256U       /* Largest data size measured */
+#define BENCH_BULK         24U        /* Bulk run, does not divide BENCH_SLOTS */
+#define BENCH_ROUNDS       (1U << 19)
+#define BENCH_REPEATS      3U
+
+#define ELEMENTS_IN(array)    ( sizeof(array) / sizeof(array[0]) )
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/* Runs a pattern for a number of rounds, returns the element ops done */
+typedef size_t (*Bench_Fn_t)(Deque_t *pQ, uint8_t *pData, size_t rounds);
+
+typedef struct _Bench_Pattern_t
+{
+    const char *pName;
+    Bench_Fn_t  pfnRun;
+} Bench_Pattern_t;
+
+/*============================================================================*
+ *                          P R I V A T E    D A T A                          *
+ *============================================================================*/
+
+static uint8_t Bench_Buf[BENCH_SLOTS * BENCH_MAX_DATA]
+    __attribute__((aligned(64)));
+static uint8_t Bench_Data[BENCH_BULK * BENCH_MAX_DATA]
+    __attribute__((aligned(64)));
+
+/* Folds popped data in so the copies cannot be optimized away */
+static volatile uint8_t Bench_Sink;
+
+static const size_t Bench_DataSizes[] = { 1, 2, 8, 64, 256 };
+static const size_t Bench_FillPcts[] = { 1, 50, 90 };
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static double Bench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/* FIFO through the back: the cursors march around and wrap regularly */
+static size_t Bench_PushBackPopFront(Deque_t *pQ, uint8_t *pData,
+                                     size_t rounds)
+{
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PushBack(pQ, pData);
+        Deque_PopFront(pQ, pData);
+    }
+    Bench_Sink ^= pData[0];
+
+    return 2 * rounds;
+}
+
+/* FIFO through the front: the cursors march backwards */
+static size_t Bench_PushFrontPopBack(Deque_t *pQ, uint8_t *pData,
+                                     size_t rounds)
+{
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PushFront(pQ, pData);
+        Deque_PopBack(pQ, pData);
+    }
+    Bench_Sink ^= pData[0];
+
+    return 2 * rounds;
+}
+
+/* LIFO at the back: the cursors stay put, no wrapping */
+static size_t Bench_PushPopBack(Deque_t *pQ, uint8_t *pData, size_t rounds)
+{
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PushBack(pQ, pData);
+        Deque_PopBack(pQ, pData);
+    }
+    Bench_Sink ^= pData[0];
+
+    return 2 * rounds;
+}
+
+static size_t Bench_PeekFront(Deque_t *pQ, uint8_t *pData, size_t rounds)
+{
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PeekFront(pQ, pData);
+        Bench_Sink ^= pData[0];
+    }
+
+    return rounds;
+}
+
+/* Random access, striding so most peeks land in another cache line */
+static size_t Bench_PeekAt(Deque_t *pQ, uint8_t *pData, size_t rounds)
+{
+    size_t count = 0;
+    size_t index = 0;
+
+    while (Deque_PeekAt(pQ, count, pData) == Deque_Error_None)
+    {
+        count++;
+    }
+
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PeekAt(pQ, index, pData);
+        Bench_Sink ^= pData[0];
+        index += 37;
+        index = (index >= count) ? (index - count) : index;
+    }
+
+    return rounds;
+}
+
+/* Bulk FIFO with a run length that does not divide the buffer, so runs keep
+ * getting split at the wrap in different places */
+static size_t Bench_BulkWrap(Deque_t *pQ, uint8_t *pData, size_t rounds)
+{
+    rounds /= BENCH_BULK;
+
+    for (size_t i = 0; i < rounds; i++)
+    {
+        Deque_PushBackN(pQ, pData, BENCH_BULK);
+        Deque_PopFrontN(pQ, pData, BENCH_BULK);
+    }
+    Bench_Sink ^= pData[0];
+
+    return 2 * BENCH_BULK * rounds;
+}
+
+static const Bench_Pattern_t Bench_Patterns[] =
+{
+    { "push_back_pop_front", Bench_PushBackPopFront },
+    { "push_front_pop_back", Bench_PushFrontPopBack },
+    { "push_pop_back",       Bench_PushPopBack },
+    { "peek_front",          Bench_PeekFront },
+    { "peek_at",             Bench_PeekAt },
+    { "bulk_wrap",           Bench_BulkWrap },
+};
+
+/* Best time of a few repeats, on a freshly filled deque each time */
+static double Bench_Measure(const Bench_Pattern_t *pPattern, bool pow2,
+                            size_t dataSize, size_t fill, size_t *pOps)
+{
+    double best = 0.0;
+
+    for (size_t repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    {
+        Deque_t q;
+        double start;
+        double seconds;
+
+        if (pow2)
+        {
+            Deque_InitPow2(&q, Bench_Buf, BENCH_SLOTS * dataSize, dataSize);
+        }
+        else
+        {
+            Deque_Init(&q, Bench_Buf, BENCH_SLOTS * dataSize, dataSize);
+        }
+
+        for (size_t i = 0; i < fill; i++)
+        {
+            Deque_PushBack(&q, Bench_Data);
+        }
+
+        start = Bench_Now();
+        *pOps = pPattern->pfnRun(&q, Bench_Data, BENCH_ROUNDS);
+        seconds = Bench_Now() - start;
+
+        if ((repeat == 0) || (seconds < best))
+        {
+            best = seconds;
+        }
+    }
+
+    return best;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+int main(int argc, char **argv)
+{
+    bool json = (argc > 1) && (strcmp(argv[1], "--json") == 0);
+    const char *pSep = "";
+
+    memset(Bench_Data, 0x5A, sizeof(Bench_Data));
+
+    if (json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("benchmark,mode,data_size,fill_pct,ops,ns_per_op,"
+               "ops_per_sec\n");
+    }
+
+    for (size_t p = 0; p < ELEMENTS_IN(Bench_Patterns); p++)
+    {
+        for (size_t mode = 0; mode < 2; mode++)
+        {
+            for (size_t d = 0; d < ELEMENTS_IN(Bench_DataSizes); d++)
+            {
+                for (size_t f = 0; f < ELEMENTS_IN(Bench_FillPcts); f++)
+                {
+                    const char *pMode = (mode == 0) ? "fixed" : "pow2";
+                    size_t fill = (BENCH_SLOTS * Bench_FillPcts[f]) / 100;
+                    size_t ops = 0;
+                    double seconds = Bench_Measure(&Bench_Patterns[p],
+                                                   (mode != 0),
+                                                   Bench_DataSizes[d], fill,
+                                                   &ops);
+                    double nsPerOp = (seconds * 1e9) / (double)ops;
+
+                    if (json)
+                    {
+                        printf("%s  {\"benchmark\": \"%s\", \"mode\": \"%s\", "
+                               "\"data_size\": %zu, \"fill_pct\": %zu, "
+                               "\"ops\": %zu, \"ns_per_op\": %.3f, "
+                               "\"ops_per_sec\": %.0f}", pSep,
+                               Bench_Patterns[p].pName, pMode,
+                               Bench_DataSizes[d], Bench_FillPcts[f], ops,
+                               nsPerOp, 1e9 / nsPerOp);
+                        pSep = ",\n";
+                    }
+                    else
+                    {
+                        printf("%s,%s,%zu,%zu,%zu,%.3f,%.0f\n",
+                               Bench_Patterns[p].pName, pMode,
+                               Bench_DataSizes[d], Bench_FillPcts[f], ops,
+                               nsPerOp, 1e9 / nsPerOp);
+                    }
+                }
+            }
+        }
+    }
+
+    if (json)
+    {
+        printf("\n]\n");
+    }
+
+#ifdef DEQUE_INSTRUMENT
+    DequeInstr_Print(stderr);
+#endif
+
+    return EXIT_SUCCESS;
+}
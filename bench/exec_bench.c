@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * @file  exec_bench.c
+ *
+ * @brief Throughput benchmarks for the work stealing executor
+ *
+ * @details Runs a fork-join workload (recursive Fibonacci, one spawn per
+ *          split) and a fan-out workload (many tiny independent tasks spawned
+ *          from one thread) for 1..N workers and prints one CSV row each:
+ *
+ *              benchmark,workers,tasks,seconds,tasks_per_sec
+ *
+ *          Normally built and run with `rake bench:exec`, or by hand with e.g.
+ *          gcc -O2 -pthread -Isrc src/deque*.c bench/exec_bench.c
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "deque_exec.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#define BENCH_MAX_WORKERS     64U
+#define BENCH_TASKS           4096U
+#define BENCH_FIB_N           30U
+#define BENCH_FIB_CUTOFF      12U
+#define BENCH_FANOUT_TASKS    1000000U
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+typedef struct _Bench_Fib_t
+{
+    DequeExec_t *pExec;
+    uint32_t     n;
+    uint64_t     result;
+} Bench_Fib_t;
+
+typedef struct _Bench_FanOut_t
+{
+    DequeExec_t       *pExec;
+    DequeExec_Group_t *pGroup;
+    atomic_size_t      done;
+} Bench_FanOut_t;
+
+/*============================================================================*
+ *                          P R I V A T E    D A T A                          *
+ *============================================================================*/
+
+static DequeExec_Worker_t Bench_Workers[BENCH_MAX_WORKERS];
+static DequeExec_Task_t Bench_Tasks[(BENCH_MAX_WORKERS + 1) * BENCH_TASKS];
+static atomic_size_t Bench_Spawned;
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static double Bench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static uint64_t Bench_FibSerial(uint32_t n)
+{
+    return (n < 2) ? n : (Bench_FibSerial(n - 1) + Bench_FibSerial(n - 2));
+}
+
+static void Bench_Fib(void *pArg)
+{
+    Bench_Fib_t *pFib = (Bench_Fib_t *)pArg;
+
+    if (pFib->n < BENCH_FIB_CUTOFF)
+    {
+        pFib->result = Bench_FibSerial(pFib->n);
+    }
+    else
+    {
+        Bench_Fib_t a = { .pExec = pFib->pExec, .n = pFib->n - 1 };
+        Bench_Fib_t b = { .pExec = pFib->pExec, .n = pFib->n - 2 };
+        DequeExec_Group_t group;
+
+        atomic_fetch_add_explicit(&Bench_Spawned, 1, memory_order_relaxed);
+        DequeExec_GroupInit(&group);
+        DequeExec_Spawn(pFib->pExec, &group, Bench_Fib, &a);
+        Bench_Fib(&b);
+        DequeExec_Join(pFib->pExec, &group);
+
+        pFib->result = a.result + b.result;
+    }
+}
+
+static void Bench_Tiny(void *pArg)
+{
+    Bench_FanOut_t *pFan = (Bench_FanOut_t *)pArg;
+
+    atomic_fetch_add_explicit(&pFan->done, 1, memory_order_relaxed);
+}
+
+static void Bench_FanOutRoot(void *pArg)
+{
+    Bench_FanOut_t *pFan = (Bench_FanOut_t *)pArg;
+
+    for (uint32_t i = 0; i < BENCH_FANOUT_TASKS; i++)
+    {
+        DequeExec_Spawn(pFan->pExec, pFan->pGroup, Bench_Tiny, pFan);
+    }
+}
+
+static void Bench_Report(const char *pName, size_t workers, size_t tasks,
+                         double seconds)
+{
+    printf("%s,%zu,%zu,%.6f,%.0f\n", pName, workers, tasks, seconds,
+           (double)tasks / seconds);
+}
+
+static void Bench_RunForkJoin(DequeExec_t *pExec, size_t workers)
+{
+    Bench_Fib_t fib = { .pExec = pExec, .n = BENCH_FIB_N };
+    DequeExec_Group_t group;
+    double start = Bench_Now();
+
+    atomic_store(&Bench_Spawned, 0);
+    DequeExec_GroupInit(&group);
+    DequeExec_Spawn(pExec, &group, Bench_Fib, &fib);
+    DequeExec_Join(pExec, &group);
+
+    if (fib.result != Bench_FibSerial(BENCH_FIB_N))
+    {
+        fprintf(stderr, "fork_join: wrong result\n");
+        exit(EXIT_FAILURE);
+    }
+
+    Bench_Report("fork_join", workers, atomic_load(&Bench_Spawned) + 1,
+                 Bench_Now() - start);
+}
+
+static void Bench_RunFanOut(DequeExec_t *pExec, size_t workers)
+{
+    DequeExec_Group_t group;
+    Bench_FanOut_t fan = { .pExec = pExec, .pGroup = &group };
+    double start = Bench_Now();
+
+    atomic_init(&fan.done, 0);
+    DequeExec_GroupInit(&group);
+
+    /* Spawn from inside a worker so the tasks go on a worker deque and get
+     * stolen by the others */
+    DequeExec_Spawn(pExec, &group, Bench_FanOutRoot, &fan);
+    DequeExec_Join(pExec, &group);
+
+    if (atomic_load(&fan.done) != BENCH_FANOUT_TASKS)
+    {
+        fprintf(stderr, "fan_out: lost tasks\n");
+        exit(EXIT_FAILURE);
+    }
+
+    Bench_Report("fan_out", workers, BENCH_FANOUT_TASKS, Bench_Now() - start);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+int main(void)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t maxWorkers = (cores < 1) ? 1 : (size_t)cores;
+    DequeExec_t exec;
+
+    if (maxWorkers > BENCH_MAX_WORKERS)
+    {
+        maxWorkers = BENCH_MAX_WORKERS;
+    }
+
+    printf("benchmark,workers,tasks,seconds,tasks_per_sec\n");
+
+    for (size_t workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        if (DequeExec_Init(&exec, Bench_Workers, workers, Bench_Tasks,
+                           BENCH_TASKS) != Deque_Error_None)
+        {
+            fprintf(stderr, "could not start %zu workers\n", workers);
+            return EXIT_FAILURE;
+        }
+
+        Bench_RunForkJoin(&exec, workers);
+        Bench_RunFanOut(&exec, workers);
+
+        DequeExec_Deinit(&exec);
+    }
+
+    return EXIT_SUCCESS;
+}
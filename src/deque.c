@@ -9,41 +9,955 @@
 /*============================================================================*
  *                              I N C L U D E S                               *
  *============================================================================*/
+#include <stdlib.h>
+
 #include "deque.h"
+#include "deque_copy.h"
+#include "deque_instr.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  malloc() backed allocation hook
+ ******************************************************************************/
+static void *Deque_StdAlloc(void *pCtx, size_t size)
+{
+    (void)pCtx;
+
+    return malloc(size);
+}
+
+/*******************************************************************************
+ * @brief  realloc() backed allocation hook
+ ******************************************************************************/
+static void *Deque_StdRealloc(void *pCtx, void *pMem, size_t oldSize,
+                              size_t newSize)
+{
+    (void)pCtx;
+    (void)oldSize;
+
+    return realloc(pMem, newSize);
+}
+
+/*******************************************************************************
+ * @brief  free() backed allocation hook
+ ******************************************************************************/
+static void Deque_StdFree(void *pCtx, void *pMem, size_t size)
+{
+    (void)pCtx;
+    (void)size;
+
+    free(pMem);
+}
+
+/*******************************************************************************
+ * @brief  Number of buffer bytes currently occupied by deque elements
+ ******************************************************************************/
+static size_t Deque_UsedBytes(Deque_t *pObj)
+{
+    size_t used;
+
+    if (Deque_IsEmpty(pObj))
+    {
+        used = 0;
+    }
+    else if (pObj->rear > pObj->front)
+    {
+        used = pObj->rear - pObj->front;
+    }
+    else
+    {
+        /* Wrapped, or full when rear == front */
+        used = pObj->bufSize - pObj->front + pObj->rear;
+    }
+
+    return used;
+}
+
+/*******************************************************************************
+ * @brief  Number of free bytes stored contiguously after the rear cursor
+ ******************************************************************************/
+static size_t Deque_ContigFreeAfterRear(Deque_t *pObj)
+{
+    size_t free;
+
+    if ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+    {
+        /* The free space runs on into the mirror, so it is all contiguous */
+        free = pObj->bufSize - Deque_UsedBytes(pObj);
+    }
+    else if (Deque_IsEmpty(pObj))
+    {
+        free = pObj->bufSize - pObj->rear;
+    }
+    else if (pObj->rear < pObj->front)
+    {
+        free = pObj->front - pObj->rear;
+    }
+    else if (pObj->rear == pObj->front)
+    {
+        free = 0;
+    }
+    else
+    {
+        free = pObj->bufSize - pObj->rear;
+    }
+
+    return free;
+}
+
+/*******************************************************************************
+ * @brief  Number of free bytes stored contiguously before the front cursor
+ ******************************************************************************/
+static size_t Deque_ContigFreeBeforeFront(Deque_t *pObj)
+{
+    size_t free;
+
+    if ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+    {
+        free = pObj->bufSize - Deque_UsedBytes(pObj);
+    }
+    else if (Deque_IsEmpty(pObj))
+    {
+        free = (pObj->rear == 0) ? pObj->bufSize : pObj->rear;
+    }
+    else if (pObj->front > pObj->rear)
+    {
+        free = pObj->front - pObj->rear;
+    }
+    else if (pObj->rear == pObj->front)
+    {
+        free = 0;
+    }
+    else
+    {
+        free = (pObj->front == 0) ? (pObj->bufSize - pObj->rear) : pObj->front;
+    }
+
+    return free;
+}
+
+/*******************************************************************************
+ * @brief  Copies a block into the buffer starting at cursor, splitting it into
+ *         at most two segments at the end of the buffer
+ *
+ * @details A mirrored buffer is never split, the copy runs into the mirror.
+ ******************************************************************************/
+static void Deque_CopyIn(Deque_t *pObj, size_t cursor, const uint8_t *pSrc,
+                         size_t size)
+{
+    size_t first = ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+                   ? size : (pObj->bufSize - cursor);
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    Deque_CopyBytes(&pObj->pBuf[cursor], pSrc, first);
+    Deque_CopyBytes(pObj->pBuf, &pSrc[first], size - first);
+}
+
+/*******************************************************************************
+ * @brief  Copies a block out of the buffer starting at cursor, splitting it
+ *         into at most two segments at the end of the buffer
+ ******************************************************************************/
+static void Deque_CopyOut(Deque_t *pObj, size_t cursor, uint8_t *pDst,
+                          size_t size)
+{
+    size_t first = ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+                   ? size : (pObj->bufSize - cursor);
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    Deque_CopyBytes(pDst, &pObj->pBuf[cursor], first);
+    Deque_CopyBytes(&pDst[first], pObj->pBuf, size - first);
+}
+
+/*******************************************************************************
+ * @brief  Copies one element into the buffer at cursor
+ *
+ * @details An element only straddles the end of the buffer when bufSize is not
+ *          a multiple of dataSize, in which case it is split like a block.
+ ******************************************************************************/
+static void Deque_ElementIn(Deque_t *pObj, size_t cursor, const uint8_t *pSrc)
+{
+    if (pObj->dataSize <= (pObj->bufSize - cursor))
+    {
+        Deque_CopyElement(&pObj->pBuf[cursor], pSrc, pObj->dataSize);
+    }
+    else
+    {
+        Deque_CopyIn(pObj, cursor, pSrc, pObj->dataSize);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Copies one element out of the buffer at cursor
+ ******************************************************************************/
+static void Deque_ElementOut(Deque_t *pObj, size_t cursor, uint8_t *pDst)
+{
+    if (pObj->dataSize <= (pObj->bufSize - cursor))
+    {
+        Deque_CopyElement(pDst, &pObj->pBuf[cursor], pObj->dataSize);
+    }
+    else
+    {
+        Deque_CopyOut(pObj, cursor, pDst, pObj->dataSize);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Moves a cursor forward by size bytes around the buffer
+ ******************************************************************************/
+static size_t Deque_CursorAdd(Deque_t *pObj, size_t cursor, size_t size)
+{
+    if (pObj->mask != 0)
+    {
+        cursor = (cursor + size) & pObj->mask;
+    }
+    else if (size >= (pObj->bufSize - cursor))
+    {
+        /* Wrap without letting cursor + size overflow */
+        cursor -= pObj->bufSize - size;
+    }
+    else
+    {
+        cursor += size;
+    }
+
+    return cursor;
+}
+
+/*******************************************************************************
+ * @brief  Moves a cursor backward by size bytes around the buffer
+ ******************************************************************************/
+static size_t Deque_CursorSub(Deque_t *pObj, size_t cursor, size_t size)
+{
+    if (pObj->mask != 0)
+    {
+        cursor = (cursor - size) & pObj->mask;
+    }
+    else if (cursor < size)
+    {
+        /* Wrap without letting cursor + bufSize overflow */
+        cursor += pObj->bufSize - size;
+    }
+    else
+    {
+        cursor -= size;
+    }
+
+    return cursor;
+}
+
+/*******************************************************************************
+ * @brief  Converts an element count into a byte count, failing if it would
+ *         overflow
+ ******************************************************************************/
+static Deque_Error_e Deque_CountToBytes(Deque_t *pObj, size_t count,
+                                        size_t *pSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (count > (SIZE_MAX / pObj->dataSize))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        *pSize = count * pObj->dataSize;
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Moves the deque into a buffer of newSize bytes
+ *
+ * @details Contents that do not wrap and fit below newSize are kept in place
+ *          with the realloc hook. Otherwise they are copied in front to back
+ *          order to the start of a new buffer, so the wrap is undone.
+ ******************************************************************************/
+static Deque_Error_e Deque_Resize(Deque_t *pObj, size_t newSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+    const Deque_Allocator_t *pAlloc = pObj->pAlloc;
+    size_t used = Deque_UsedBytes(pObj);
+    size_t keep = (newSize < pObj->bufSize) ? newSize : pObj->bufSize;
+    bool inPlace = Deque_IsEmpty(pObj) ||
+                   ((pObj->front <= keep) && (used <= (keep - pObj->front)));
+    uint8_t *pNew;
+
+    if ((pAlloc->pfnRealloc != NULL) && inPlace)
+    {
+        pNew = pAlloc->pfnRealloc(pAlloc->pCtx, pObj->pBuf, pObj->bufSize,
+                                  newSize);
+    }
+    else
+    {
+        pNew = pAlloc->pfnAlloc(pAlloc->pCtx, newSize);
+        inPlace = false;
+    }
+
+    if (pNew == NULL)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        if (!inPlace)
+        {
+            if (used > 0)
+            {
+                Deque_CopyOut(pObj, pObj->front, pNew, used);
+                pObj->front = 0;
+            }
+
+            pAlloc->pfnFree(pAlloc->pCtx, pObj->pBuf, pObj->bufSize);
+        }
+
+        pObj->pBuf = pNew;
+        pObj->bufSize = newSize;
+        if (pObj->mask != 0)
+        {
+            pObj->mask = newSize - 1;
+        }
+
+        pObj->rear = Deque_IsEmpty(pObj) ? 0
+                                         : Deque_CursorAdd(pObj, pObj->front,
+                                                           used);
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Doubles a dynamic deque until size more bytes fit
+ ******************************************************************************/
+static Deque_Error_e Deque_Grow(Deque_t *pObj, size_t size)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t used = Deque_UsedBytes(pObj);
+    size_t newSize = pObj->bufSize;
+
+    if ((pObj->pAlloc == NULL) || (size > (SIZE_MAX / 2) - used))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        while ((newSize - used) < size)
+        {
+            newSize *= 2;
+        }
+
+        err = Deque_Resize(pObj, newSize);
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Halves a dynamic deque once it is no more than a quarter full
+ *
+ * @details Shrinking to half leaves the deque at most half full, so a push
+ *          straight after cannot grow it again.
+ ******************************************************************************/
+static void Deque_Shrink(Deque_t *pObj)
+{
+    if ((pObj->pAlloc != NULL) && (pObj->bufSize > pObj->minSize) &&
+        (Deque_UsedBytes(pObj) <= (pObj->bufSize / 4)))
+    {
+        /* Keeping the bigger buffer is fine if this fails */
+        (void)Deque_Resize(pObj, pObj->bufSize / 2);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Pushes onto the back of a full deque over the front element
+ *
+ * @details Full means the rear cursor has met the front cursor, so the new
+ *          element goes straight into the front element's bytes and both
+ *          cursors step on together.
+ ******************************************************************************/
+static void Deque_Evict(Deque_t *pObj, const uint8_t *pDataIn,
+                        uint8_t *pEvictedOut)
+{
+    if (pEvictedOut != NULL)
+    {
+        Deque_ElementOut(pObj, pObj->front, pEvictedOut);
+    }
+
+    Deque_ElementIn(pObj, pObj->rear, pDataIn);
+    pObj->rear = Deque_CursorAdd(pObj, pObj->rear, pObj->dataSize);
+    pObj->front = pObj->rear;
+}
+
+/*******************************************************************************
+ * @brief  Splits the stored data into at most two runs, front first
+ *
+ * @returns true if the deque holds any data
+ ******************************************************************************/
+static bool Deque_FrontSpans(Deque_t *pObj, Deque_Span_t spans[2])
+{
+    size_t used = Deque_UsedBytes(pObj);
+
+    spans[0].pData = NULL;
+    spans[0].count = 0;
+    spans[1].pData = NULL;
+    spans[1].count = 0;
+
+    /* The front cursor is stashed as SIZE_MAX while empty, so no pointer can
+     * be formed from it */
+    if (used > 0)
+    {
+        size_t first = ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+                       ? used : (pObj->bufSize - pObj->front);
+
+        if (first > used)
+        {
+            first = used;
+        }
+
+        spans[0].pData = &pObj->pBuf[pObj->front];
+        spans[0].count = first / pObj->dataSize;
+        spans[1].pData = pObj->pBuf;
+        spans[1].count = (used - first) / pObj->dataSize;
+    }
+
+    return (used > 0);
+}
+
+/*******************************************************************************
+ * @brief  Moves the front cursor past size bytes of stored data
+ ******************************************************************************/
+static void Deque_DropFront(Deque_t *pObj, size_t size)
+{
+    if (size > 0)
+    {
+        pObj->front = Deque_CursorAdd(pObj, pObj->front, size);
+
+        if (Deque_IsFull(pObj))
+        {
+            /* Stash front cursor */
+            pObj->front = SIZE_MAX;
+        }
+
+        Deque_Shrink(pObj);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Checks that no element can straddle the end of the buffer, so that
+ *         every element can be handed out as one pointer
+ ******************************************************************************/
+static bool Deque_IterInPlace(Deque_t *pObj)
+{
+    return (((pObj->flags & DEQUE_FLAG_MIRRORED) != 0) ||
+            ((pObj->bufSize % pObj->dataSize) == 0));
+}
+
+/*******************************************************************************
+ * @brief  Counts a push of count elements, or a failed push
+ ******************************************************************************/
+static void Deque_StatPush(Deque_t *pObj, Deque_Error_e err, bool front,
+                           size_t count)
+{
+    Deque_Stats_t *pStats = pObj->pStats;
+
+    if (pStats == NULL)
+    {
+        /* Not counting */
+    }
+    else if (err != Deque_Error_None)
+    {
+        pStats->pushFails++;
+    }
+    else
+    {
+        size_t used = Deque_UsedBytes(pObj) / pObj->dataSize;
+
+        *(front ? &pStats->pushFront : &pStats->pushBack) += count;
+        if (used > pStats->highWater)
+        {
+            pStats->highWater = used;
+        }
+    }
+}
+
+/*******************************************************************************
+ * @brief  Counts a pop of count elements, or a failed pop
+ ******************************************************************************/
+static void Deque_StatPop(Deque_t *pObj, Deque_Error_e err, bool front,
+                          size_t count)
+{
+    Deque_Stats_t *pStats = pObj->pStats;
+
+    if (pStats == NULL)
+    {
+        /* Not counting */
+    }
+    else if (err != Deque_Error_None)
+    {
+        pStats->popFails++;
+    }
+    else
+    {
+        *(front ? &pStats->popFront : &pStats->popBack) += count;
+    }
+}
+
+/*============================================================================*
+ *                          P U B L I C    D A T A                            *
+ *============================================================================*/
+
+const Deque_Allocator_t Deque_StdAllocator =
+{
+    .pfnAlloc   = Deque_StdAlloc,
+    .pfnRealloc = Deque_StdRealloc,
+    .pfnFree    = Deque_StdFree,
+    .pCtx       = NULL,
+};
 
 /*============================================================================*
  *                      P U B L I C    F U N C T I O N S                      *
  *============================================================================*/
 
-void Deque_Init(Deque_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
-{
-    pObj->bufSize = bufSize;
-    pObj->front = SIZE_MAX;
-    pObj->rear = 0;
-    pObj->pBuf = pBuf;
-    pObj->dataSize = dataSize;
+void Deque_Init(Deque_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    pObj->bufSize = bufSize;
+    pObj->front = SIZE_MAX;
+    pObj->rear = 0;
+    pObj->pBuf = pBuf;
+    pObj->dataSize = dataSize;
+    pObj->mask = 0;
+    pObj->pAlloc = NULL;
+    pObj->minSize = 0;
+    pObj->flags = 0;
+    pObj->pStats = NULL;
+}
+
+Deque_Error_e Deque_InitPow2(Deque_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((bufSize == 0) || ((bufSize & (bufSize - 1)) != 0) ||
+        (dataSize == 0) || ((bufSize % dataSize) != 0))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_Init(pObj, pBuf, bufSize, dataSize);
+        pObj->mask = bufSize - 1;
+    }
+
+    return err;
+}
+
+Deque_Error_e Deque_InitDynamic(Deque_t *pObj,
+                                const Deque_Allocator_t *pAlloc, size_t count,
+                                size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t bufSize = count * dataSize;
+    void *pBuf = NULL;
+
+    if ((count == 0) || (dataSize == 0) || (count > (SIZE_MAX / dataSize)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pBuf = pAlloc->pfnAlloc(pAlloc->pCtx, bufSize);
+        if (pBuf == NULL)
+        {
+            err = Deque_Error;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        Deque_Init(pObj, pBuf, bufSize, dataSize);
+        pObj->pAlloc = pAlloc;
+        pObj->minSize = bufSize;
+
+        if ((bufSize & (bufSize - 1)) == 0)
+        {
+            /* Doubling and halving keep a power of two a power of two */
+            pObj->mask = bufSize - 1;
+        }
+    }
+
+    return err;
+}
+
+void Deque_Deinit(Deque_t *pObj)
+{
+    if (pObj->pAlloc != NULL)
+    {
+        pObj->pAlloc->pfnFree(pObj->pAlloc->pCtx, pObj->pBuf, pObj->bufSize);
+        pObj->pAlloc = NULL;
+    }
+
+    pObj->pBuf = NULL;
+    pObj->bufSize = 0;
+    pObj->front = SIZE_MAX;
+    pObj->rear = 0;
+}
+
+void Deque_AttachStats(Deque_t *pObj, Deque_Stats_t *pStats)
+{
+    if (pStats != NULL)
+    {
+        *pStats = (Deque_Stats_t){ 0 };
+        pStats->highWater = Deque_UsedBytes(pObj) / pObj->dataSize;
+    }
+
+    pObj->pStats = pStats;
+}
+
+Deque_Error_e Deque_GetStats(Deque_t *pObj, Deque_Stats_t *pStats)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (pObj->pStats == NULL)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        *pStats = *pObj->pStats;
+    }
+
+    return err;
+}
+
+bool Deque_IsEmpty(Deque_t *pObj)
+{
+    return (pObj->front == SIZE_MAX);
+}
+
+bool Deque_IsFull(Deque_t *pObj)
+{
+    return (pObj->rear == pObj->front);
+}
+
+void Deque_SetOverwrite(Deque_t *pObj, bool enabled)
+{
+    if (enabled && (pObj->pAlloc == NULL))
+    {
+        pObj->flags |= DEQUE_FLAG_OVERWRITE;
+    }
+    else
+    {
+        pObj->flags &= ~DEQUE_FLAG_OVERWRITE;
+    }
+}
+
+Deque_Error_e Deque_PushFront(Deque_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    uint8_t *pDataIn = (uint8_t *)pDataInVoid;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsFull(pObj) &&
+        (Deque_Grow(pObj, pObj->dataSize) != Deque_Error_None))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        if (Deque_IsEmpty(pObj))
+        {
+            /* Unstash front cursor */
+            pObj->front = pObj->rear;
+        }
+
+        /* Decrement cursor around buffer, then push the data into the deque */
+        pObj->front = Deque_CursorSub(pObj, pObj->front, pObj->dataSize);
+        Deque_ElementIn(pObj, pObj->front, pDataIn);
+    }
+
+    Deque_StatPush(pObj, err, true, 1);
+    DEQUE_PROBE_END(Deque_Op_PushFront);
+    return err;
+}
+
+Deque_Error_e Deque_PushBack(Deque_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    uint8_t *pDataIn = (uint8_t *)pDataInVoid;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (!Deque_IsFull(pObj))
+    {
+        if (Deque_IsEmpty(pObj))
+        {
+            /* Unstash front cursor */
+            pObj->front = pObj->rear;
+        }
+
+        /* Push the data into the deque, then increment cursor around buffer */
+        Deque_ElementIn(pObj, pObj->rear, pDataIn);
+        pObj->rear = Deque_CursorAdd(pObj, pObj->rear, pObj->dataSize);
+    }
+    else if ((pObj->flags & DEQUE_FLAG_OVERWRITE) != 0)
+    {
+        Deque_Evict(pObj, pDataIn, NULL);
+        Deque_StatPop(pObj, Deque_Error_None, true, 1);
+    }
+    else if (Deque_Grow(pObj, pObj->dataSize) != Deque_Error_None)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* Grown, so there is room behind the rear */
+        Deque_ElementIn(pObj, pObj->rear, pDataIn);
+        pObj->rear = Deque_CursorAdd(pObj, pObj->rear, pObj->dataSize);
+    }
+
+    Deque_StatPush(pObj, err, false, 1);
+    DEQUE_PROBE_END(Deque_Op_PushBack);
+    return err;
+}
+
+bool Deque_PushBackOverwrite(Deque_t *pObj, void *pDataInVoid,
+                             void *pEvictedOutVoid)
+{
+    uint8_t *pDataIn = (uint8_t *)pDataInVoid;
+    bool evicted = false;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsFull(pObj) &&
+        (Deque_Grow(pObj, pObj->dataSize) != Deque_Error_None))
+    {
+        Deque_Evict(pObj, pDataIn, (uint8_t *)pEvictedOutVoid);
+        Deque_StatPop(pObj, Deque_Error_None, true, 1);
+        evicted = true;
+    }
+    else
+    {
+        if (Deque_IsEmpty(pObj))
+        {
+            /* Unstash front cursor */
+            pObj->front = pObj->rear;
+        }
+
+        Deque_ElementIn(pObj, pObj->rear, pDataIn);
+        pObj->rear = Deque_CursorAdd(pObj, pObj->rear, pObj->dataSize);
+    }
+
+    Deque_StatPush(pObj, Deque_Error_None, false, 1);
+    DEQUE_PROBE_END(Deque_Op_PushBackOverwrite);
+    return evicted;
+}
+
+Deque_Error_e Deque_PopFront(Deque_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    uint8_t *pDataOut = (uint8_t *)pDataOutVoid;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* Pop the data off the deque, then increment cursor around buffer */
+        Deque_ElementOut(pObj, pObj->front, pDataOut);
+        pObj->front = Deque_CursorAdd(pObj, pObj->front, pObj->dataSize);
+
+        if (Deque_IsFull(pObj))
+        {
+            /* Stash front cursor */
+            pObj->front = SIZE_MAX;
+        }
+
+        Deque_Shrink(pObj);
+    }
+
+    Deque_StatPop(pObj, err, true, 1);
+    DEQUE_PROBE_END(Deque_Op_PopFront);
+    return err;
+}
+
+Deque_Error_e Deque_PopBack(Deque_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    uint8_t *pDataOut = (uint8_t *)pDataOutVoid;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* Decrement cursor around buffer, then pop the data off the deque */
+        pObj->rear = Deque_CursorSub(pObj, pObj->rear, pObj->dataSize);
+        Deque_ElementOut(pObj, pObj->rear, pDataOut);
+
+        if (Deque_IsFull(pObj))
+        {
+            /* Stash front cursor */
+            pObj->front = SIZE_MAX;
+        }
+
+        Deque_Shrink(pObj);
+    }
+
+    Deque_StatPop(pObj, err, false, 1);
+    DEQUE_PROBE_END(Deque_Op_PopBack);
+    return err;
+}
+
+Deque_Error_e Deque_PeekFront(Deque_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_ElementOut(pObj, pObj->front, (uint8_t *)pDataOutVoid);
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekFront);
+    return err;
+}
+
+Deque_Error_e Deque_PeekBack(Deque_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_ElementOut(pObj,
+                         Deque_CursorSub(pObj, pObj->rear, pObj->dataSize),
+                         (uint8_t *)pDataOutVoid);
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekBack);
+    return err;
+}
+
+Deque_Error_e Deque_PeekAt(Deque_t *pObj, size_t index, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (index >= (Deque_UsedBytes(pObj) / pObj->dataSize))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_ElementOut(pObj,
+                         Deque_CursorAdd(pObj, pObj->front,
+                                         index * pObj->dataSize),
+                         (uint8_t *)pDataOutVoid);
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekAt);
+    return err;
 }
 
-bool Deque_IsEmpty(Deque_t *pObj)
+Deque_Error_e Deque_PeekAtBack(Deque_t *pObj, size_t index, void *pDataOutVoid)
 {
-    return (pObj->front == SIZE_MAX);
+    Deque_Error_e err = Deque_Error_None;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (index >= (Deque_UsedBytes(pObj) / pObj->dataSize))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_ElementOut(pObj,
+                         Deque_CursorSub(pObj, pObj->rear,
+                                         (index + 1) * pObj->dataSize),
+                         (uint8_t *)pDataOutVoid);
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekAtBack);
+    return err;
 }
 
-bool Deque_IsFull(Deque_t *pObj)
+Deque_Error_e Deque_PushFrontN(Deque_t *pObj, void *pDataInVoid, size_t count)
 {
-    return (pObj->rear == pObj->front);
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
+
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) ||
+        ((size > (pObj->bufSize - Deque_UsedBytes(pObj))) &&
+         (Deque_Grow(pObj, size) != Deque_Error_None)))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
+    {
+        if (Deque_IsEmpty(pObj))
+        {
+            /* Unstash front cursor */
+            pObj->front = pObj->rear;
+        }
+
+        pObj->front = Deque_CursorSub(pObj, pObj->front, size);
+        Deque_CopyIn(pObj, pObj->front, (uint8_t *)pDataInVoid, size);
+    }
+
+    Deque_StatPush(pObj, err, true, count);
+    DEQUE_PROBE_END(Deque_Op_PushFrontN);
+    return err;
 }
 
-Deque_Error_e Deque_PushFront(Deque_t *pObj, void *pDataInVoid)
+Deque_Error_e Deque_PushBackN(Deque_t *pObj, void *pDataInVoid, size_t count)
 {
     Deque_Error_e err = Deque_Error_None;
-    uint8_t *pDataIn = (uint8_t *)pDataInVoid;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
 
-    if (Deque_IsFull(pObj))
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) ||
+        ((size > (pObj->bufSize - Deque_UsedBytes(pObj))) &&
+         (Deque_Grow(pObj, size) != Deque_Error_None)))
     {
         err = Deque_Error;
     }
-    else
+    else if (size > 0)
     {
         if (Deque_IsEmpty(pObj))
         {
@@ -51,33 +965,132 @@ Deque_Error_e Deque_PushFront(Deque_t *pObj, void *pDataInVoid)
             pObj->front = pObj->rear;
         }
 
-        /* Push the data into the deque one byte at a time */
-        for (size_t byte = pObj->dataSize - 1; byte < pObj->dataSize; byte--)
+        Deque_CopyIn(pObj, pObj->rear, (uint8_t *)pDataInVoid, size);
+        pObj->rear = Deque_CursorAdd(pObj, pObj->rear, size);
+    }
+
+    Deque_StatPush(pObj, err, false, count);
+    DEQUE_PROBE_END(Deque_Op_PushBackN);
+    return err;
+}
+
+Deque_Error_e Deque_PopFrontN(Deque_t *pObj, void *pDataOutVoid, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
+
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) || (size > Deque_UsedBytes(pObj)))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
+    {
+        Deque_CopyOut(pObj, pObj->front, (uint8_t *)pDataOutVoid, size);
+        pObj->front = Deque_CursorAdd(pObj, pObj->front, size);
+
+        if (Deque_IsFull(pObj))
         {
-            /* Decrement cursor around buffer */
-            pObj->front--;
-            if (pObj->front >= pObj->bufSize)
-            {
-                pObj->front = pObj->bufSize - 1;
-            }
+            /* Stash front cursor */
+            pObj->front = SIZE_MAX;
+        }
+
+        Deque_Shrink(pObj);
+    }
+
+    Deque_StatPop(pObj, err, true, count);
+    DEQUE_PROBE_END(Deque_Op_PopFrontN);
+    return err;
+}
+
+Deque_Error_e Deque_PopBackN(Deque_t *pObj, void *pDataOutVoid, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
+
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) || (size > Deque_UsedBytes(pObj)))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
+    {
+        pObj->rear = Deque_CursorSub(pObj, pObj->rear, size);
+        Deque_CopyOut(pObj, pObj->rear, (uint8_t *)pDataOutVoid, size);
 
-            pObj->pBuf[pObj->front] = pDataIn[byte];
+        if (Deque_IsFull(pObj))
+        {
+            /* Stash front cursor */
+            pObj->front = SIZE_MAX;
         }
+
+        Deque_Shrink(pObj);
     }
 
+    Deque_StatPop(pObj, err, false, count);
+    DEQUE_PROBE_END(Deque_Op_PopBackN);
     return err;
 }
 
-Deque_Error_e Deque_PushBack(Deque_t *pObj, void *pDataInVoid)
+Deque_Error_e Deque_ReserveFront(Deque_t *pObj, size_t count, void **ppDataIn,
+                                 size_t *pCount)
 {
     Deque_Error_e err = Deque_Error_None;
-    uint8_t *pDataIn = (uint8_t *)pDataInVoid;
+    size_t free;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (Deque_IsEmpty(pObj))
+    {
+        /* Rewind so the whole buffer is contiguous */
+        pObj->rear = 0;
+    }
 
-    if (Deque_IsFull(pObj))
+    free = Deque_ContigFreeBeforeFront(pObj) / pObj->dataSize;
+
+    if ((free == 0) &&
+        (Deque_Grow(pObj, pObj->dataSize) == Deque_Error_None))
+    {
+        free = Deque_ContigFreeBeforeFront(pObj) / pObj->dataSize;
+    }
+
+    if (free == 0)
     {
         err = Deque_Error;
+        *pCount = 0;
+        Deque_StatPush(pObj, err, true, 0);
     }
     else
+    {
+        size_t front = Deque_IsEmpty(pObj) ? pObj->rear : pObj->front;
+
+        *pCount = (count < free) ? count : free;
+        *ppDataIn = &pObj->pBuf[Deque_CursorSub(pObj, front,
+                                                *pCount * pObj->dataSize)];
+    }
+
+    DEQUE_PROBE_END(Deque_Op_ReserveFront);
+    return err;
+}
+
+Deque_Error_e Deque_CommitFront(Deque_t *pObj, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = count * pObj->dataSize;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (count > (Deque_ContigFreeBeforeFront(pObj) / pObj->dataSize))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
     {
         if (Deque_IsEmpty(pObj))
         {
@@ -85,61 +1098,105 @@ Deque_Error_e Deque_PushBack(Deque_t *pObj, void *pDataInVoid)
             pObj->front = pObj->rear;
         }
 
-        /* Push the data into the deque one byte at a time */
-        for (size_t byte = 0; byte < pObj->dataSize; byte++)
-        {
-            pObj->pBuf[pObj->rear] = pDataIn[byte];
-
-            /* Increment cursor around buffer */
-            pObj->rear++;
-            if (pObj->rear >= pObj->bufSize)
-            {
-                pObj->rear = 0;
-            }
-        }
+        pObj->front = Deque_CursorSub(pObj, pObj->front, size);
     }
 
+    Deque_StatPush(pObj, err, true, count);
+    DEQUE_PROBE_END(Deque_Op_CommitFront);
     return err;
 }
 
-Deque_Error_e Deque_PopFront(Deque_t *pObj, void *pDataOutVoid)
+Deque_Error_e Deque_ReserveBack(Deque_t *pObj, size_t count, void **ppDataIn,
+                                size_t *pCount)
 {
     Deque_Error_e err = Deque_Error_None;
-    uint8_t *pDataOut = (uint8_t *)pDataOutVoid;
+    size_t free;
+
+    DEQUE_PROBE_BEGIN();
 
     if (Deque_IsEmpty(pObj))
+    {
+        /* Rewind so the whole buffer is contiguous */
+        pObj->rear = 0;
+    }
+
+    free = Deque_ContigFreeAfterRear(pObj) / pObj->dataSize;
+
+    if ((free == 0) &&
+        (Deque_Grow(pObj, pObj->dataSize) == Deque_Error_None))
+    {
+        free = Deque_ContigFreeAfterRear(pObj) / pObj->dataSize;
+    }
+
+    if (free == 0)
     {
         err = Deque_Error;
+        *pCount = 0;
+        Deque_StatPush(pObj, err, false, 0);
     }
     else
     {
-        /* Pop the data off the deque one byte at a time */
-        for (size_t byte = 0; byte < pObj->dataSize; byte++)
-        {
-            pDataOut[byte] = pObj->pBuf[pObj->front];
+        *pCount = (count < free) ? count : free;
+        *ppDataIn = &pObj->pBuf[pObj->rear];
+    }
 
-            /* Increment cursor around buffer */
-            pObj->front++;
-            if (pObj->front >= pObj->bufSize)
-            {
-                pObj->front = 0;
-            }
-        }
+    DEQUE_PROBE_END(Deque_Op_ReserveBack);
+    return err;
+}
 
-        if (Deque_IsFull(pObj))
+Deque_Error_e Deque_CommitBack(Deque_t *pObj, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = count * pObj->dataSize;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (count > (Deque_ContigFreeAfterRear(pObj) / pObj->dataSize))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
+    {
+        if (Deque_IsEmpty(pObj))
         {
-            /* Stash front cursor */
-            pObj->front = SIZE_MAX;
+            /* Unstash front cursor */
+            pObj->front = pObj->rear;
         }
+
+        pObj->rear = Deque_CursorAdd(pObj, pObj->rear, size);
     }
 
+    Deque_StatPush(pObj, err, false, count);
+    DEQUE_PROBE_END(Deque_Op_CommitBack);
     return err;
 }
 
-Deque_Error_e Deque_PopBack(Deque_t *pObj, void *pDataOutVoid)
+Deque_Error_e Deque_PeekFrontSpans(Deque_t *pObj, Deque_Span_t spans[2])
 {
     Deque_Error_e err = Deque_Error_None;
-    uint8_t *pDataOut = (uint8_t *)pDataOutVoid;
+
+    DEQUE_PROBE_BEGIN();
+
+    if (!Deque_FrontSpans(pObj, spans))
+    {
+        err = Deque_Error;
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekFrontSpans);
+    return err;
+}
+
+Deque_Error_e Deque_PeekBackSpans(Deque_t *pObj, Deque_Span_t spans[2])
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t used = Deque_UsedBytes(pObj);
+
+    DEQUE_PROBE_BEGIN();
+
+    spans[0].pData = NULL;
+    spans[0].count = 0;
+    spans[1].pData = NULL;
+    spans[1].count = 0;
 
     if (Deque_IsEmpty(pObj))
     {
@@ -147,51 +1204,197 @@ Deque_Error_e Deque_PopBack(Deque_t *pObj, void *pDataOutVoid)
     }
     else
     {
-        /* Pop the data off the deque one byte at a time */
-        for (size_t byte = pObj->dataSize - 1; byte < pObj->dataSize; byte--)
-        {
-            /* Decrement cursor around buffer */
-            pObj->rear--;
-            if (pObj->rear >= pObj->bufSize)
-            {
-                pObj->rear = pObj->bufSize - 1;
-            }
+        /* A rear cursor of 0 means the data ends at the end of the buffer.
+         * In a mirror it ends used bytes on from the front, maybe in the
+         * mirror itself */
+        size_t end = ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+                     ? (pObj->front + used)
+                     : ((pObj->rear == 0) ? pObj->bufSize : pObj->rear);
+        size_t first = (end < used) ? end : used;
 
-            pDataOut[byte] = pObj->pBuf[pObj->rear];
-        }
+        spans[0].pData = &pObj->pBuf[end - first];
+        spans[0].count = first / pObj->dataSize;
+        spans[1].pData = &pObj->pBuf[pObj->bufSize - (used - first)];
+        spans[1].count = (used - first) / pObj->dataSize;
+    }
+
+    DEQUE_PROBE_END(Deque_Op_PeekBackSpans);
+    return err;
+}
+
+Deque_Error_e Deque_ReleaseFront(Deque_t *pObj, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
+
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) || (size > Deque_UsedBytes(pObj)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_DropFront(pObj, size);
+    }
+
+    Deque_StatPop(pObj, err, true, count);
+    DEQUE_PROBE_END(Deque_Op_ReleaseFront);
+    return err;
+}
+
+Deque_Error_e Deque_ReleaseBack(Deque_t *pObj, size_t count)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t size = 0;
+
+    DEQUE_PROBE_BEGIN();
+
+    err = Deque_CountToBytes(pObj, count, &size);
+
+    if ((err != Deque_Error_None) || (size > Deque_UsedBytes(pObj)))
+    {
+        err = Deque_Error;
+    }
+    else if (size > 0)
+    {
+        pObj->rear = Deque_CursorSub(pObj, pObj->rear, size);
 
         if (Deque_IsFull(pObj))
         {
             /* Stash front cursor */
             pObj->front = SIZE_MAX;
         }
+
+        Deque_Shrink(pObj);
     }
 
+    Deque_StatPop(pObj, err, false, count);
+    DEQUE_PROBE_END(Deque_Op_ReleaseBack);
     return err;
 }
 
-Deque_Error_e Deque_PeekFront(Deque_t *pObj, void *pDataOutVoid)
+Deque_Error_e Deque_IterBegin(Deque_t *pObj, Deque_Iter_t *pIter)
 {
     Deque_Error_e err = Deque_Error_None;
-    size_t front = pObj->front;
-    size_t rear = pObj->rear;
 
-    err = Deque_PopFront(pObj, pDataOutVoid);
+    pIter->pDeque = pObj;
+    pIter->cursor = pObj->front;
+    pIter->remaining = 0;
+
+    if (!Deque_IterInPlace(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pIter->remaining = Deque_UsedBytes(pObj) / pObj->dataSize;
+    }
 
-    pObj->front = front;
-    pObj->rear = rear;
     return err;
 }
 
-Deque_Error_e Deque_PeekBack(Deque_t *pObj, void *pDataOutVoid)
+Deque_Error_e Deque_IterBeginBack(Deque_t *pObj, Deque_Iter_t *pIter)
 {
     Deque_Error_e err = Deque_Error_None;
-    size_t front = pObj->front;
-    size_t rear = pObj->rear;
 
-    err = Deque_PopBack(pObj, pDataOutVoid);
+    pIter->pDeque = pObj;
+    pIter->cursor = pObj->rear;
+    pIter->remaining = 0;
+
+    if (!Deque_IterInPlace(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pIter->remaining = Deque_UsedBytes(pObj) / pObj->dataSize;
+    }
 
-    pObj->front = front;
-    pObj->rear = rear;
     return err;
-}
\ No newline at end of file
+}
+
+void *Deque_IterNext(Deque_Iter_t *pIter)
+{
+    Deque_t *pObj = pIter->pDeque;
+    void *pData = NULL;
+
+    if (pIter->remaining > 0)
+    {
+        pData = &pObj->pBuf[pIter->cursor];
+        pIter->cursor = Deque_CursorAdd(pObj, pIter->cursor, pObj->dataSize);
+        pIter->remaining--;
+    }
+
+    return pData;
+}
+
+void *Deque_IterPrev(Deque_Iter_t *pIter)
+{
+    Deque_t *pObj = pIter->pDeque;
+    void *pData = NULL;
+
+    if (pIter->remaining > 0)
+    {
+        pIter->cursor = Deque_CursorSub(pObj, pIter->cursor, pObj->dataSize);
+        pData = &pObj->pBuf[pIter->cursor];
+        pIter->remaining--;
+    }
+
+    return pData;
+}
+
+size_t Deque_ForEach(Deque_t *pObj, Deque_VisitFn_t pfnVisit, void *pCtx)
+{
+    Deque_Span_t spans[2];
+    size_t visited = 0;
+    bool more = Deque_FrontSpans(pObj, spans);
+
+    DEQUE_PROBE_BEGIN();
+
+    for (size_t s = 0; more && (s < 2); s++)
+    {
+        uint8_t *pData = spans[s].pData;
+
+        for (size_t i = 0; more && (i < spans[s].count); i++)
+        {
+            more = pfnVisit(pCtx, pData);
+            pData += pObj->dataSize;
+            visited++;
+        }
+    }
+
+    DEQUE_PROBE_END(Deque_Op_ForEach);
+    return visited;
+}
+
+size_t Deque_DrainFront(Deque_t *pObj, Deque_DrainFn_t pfnDrain, void *pCtx)
+{
+    Deque_Span_t spans[2];
+    size_t drained = 0;
+    bool more = Deque_FrontSpans(pObj, spans);
+
+    DEQUE_PROBE_BEGIN();
+
+    for (size_t s = 0; more && (s < 2) && (spans[s].count > 0); s++)
+    {
+        size_t taken = pfnDrain(pCtx, spans[s].pData, spans[s].count);
+
+        if (taken > spans[s].count)
+        {
+            taken = spans[s].count;
+        }
+
+        drained += taken;
+        more = (taken == spans[s].count);
+    }
+
+    /* One cursor update for the whole batch */
+    Deque_DropFront(pObj, drained * pObj->dataSize);
+
+    Deque_StatPop(pObj, Deque_Error_None, true, drained);
+    DEQUE_PROBE_END(Deque_Op_DrainFront);
+    return drained;
+}
@@ -17,6 +17,15 @@
 
 #include "deque_t.h"
 
+/*============================================================================*
+ *                         P U B L I C    D A T A                             *
+ *============================================================================*/
+
+/**
+ * @brief  Memory hooks backed by malloc(), realloc() and free()
+**/
+extern const Deque_Allocator_t Deque_StdAllocator;
+
 /*============================================================================*
  *                 F U N C T I O N    D E C L A R A T I O N S                 *
  *============================================================================*/
@@ -34,6 +43,103 @@
  ******************************************************************************/
 void Deque_Init(Deque_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
 
+/*******************************************************************************
+ * @brief  Initializes the deque object with a power of two buffer
+ *
+ * @details Same as Deque_Init(), but the cursors wrap around the buffer with a
+ *          single mask instead of a compare and reset. Since dataSize must
+ *          divide bufSize, both end up being powers of two.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pBuf      Pointer to the deque buffer
+ * @param bufSize   Size of the buffer, must be a power of two
+ * @param dataSize  Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if bufSize is not a power of two multiple of
+ *          dataSize
+ ******************************************************************************/
+Deque_Error_e Deque_InitPow2(Deque_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Initializes a deque that allocates and resizes its own buffer
+ *
+ * @details Pushing onto a full dynamic deque doubles the buffer instead of
+ *          failing. Popping it down to a quarter full halves the buffer, but
+ *          never below the initial size. Each resize copies the contents at
+ *          most once, undoing any wrap. Pointers handed out by the span and
+ *          reserve functions are invalidated by a resize. A power of two
+ *          initial size also gets the Deque_InitPow2() cursor masking.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pAlloc    Memory hooks, e.g. &Deque_StdAllocator. Must outlive the
+ *                  deque
+ * @param count     Initial, and minimum, number of elements
+ * @param dataSize  Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if the initial buffer could not be allocated
+ ******************************************************************************/
+Deque_Error_e Deque_InitDynamic(Deque_t *pObj,
+                                const Deque_Allocator_t *pAlloc, size_t count,
+                                size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Releases the buffer of a dynamic deque
+ *
+ * @details Does nothing to the caller's buffer of a deque set up with
+ *          Deque_Init(). The deque is left empty with no buffer.
+ *
+ * @param pObj  Pointer to the deque object
+ ******************************************************************************/
+void Deque_Deinit(Deque_t *pObj);
+
+/*******************************************************************************
+ * @brief  Initializes a deque whose buffer is mapped twice back to back
+ *
+ * @details pBuf[bufSize + i] aliases pBuf[i], so every element, bulk copy,
+ *          span and reservation is contiguous and never split at the wrap.
+ *          The size is rounded up to a multiple of both the page size and
+ *          dataSize. Only available on Linux, elsewhere it always fails.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param minSize   Smallest acceptable buffer size in bytes
+ * @param dataSize  Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if the mapping could not be created
+ ******************************************************************************/
+Deque_Error_e Deque_InitMirrored(Deque_t *pObj, size_t minSize,
+                                 size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Unmaps the buffer of a deque set up with Deque_InitMirrored()
+ *
+ * @param pObj  Pointer to the deque object
+ ******************************************************************************/
+void Deque_DeinitMirrored(Deque_t *pObj);
+
+/*******************************************************************************
+ * @brief  Starts counting the operations of a deque
+ *
+ * @details The counters are zeroed and then updated by every push, pop,
+ *          commit and release. They live in the caller's pStats, which must
+ *          outlive the deque or be detached first. Not thread safe, like the
+ *          deque itself.
+ *
+ * @param pObj    Pointer to the deque object
+ * @param pStats  Pointer to the counters, NULL to stop counting
+ ******************************************************************************/
+void Deque_AttachStats(Deque_t *pObj, Deque_Stats_t *pStats);
+
+/*******************************************************************************
+ * @brief  Copies out the counters of a deque
+ *
+ * @param pObj    Pointer to the deque object
+ * @param pStats  Pointer to the copy
+ *
+ * @returns Deque error flag, set if no counters are attached
+ ******************************************************************************/
+Deque_Error_e Deque_GetStats(Deque_t *pObj, Deque_Stats_t *pStats);
+
 /*******************************************************************************
  * @brief  Check if the deque is empty
  *
@@ -64,10 +170,23 @@ bool Deque_IsFull(Deque_t *pObj);
  ******************************************************************************/
 Deque_Error_e Deque_PushFront(Deque_t *pObj, void *pDataInVoid);
 
+/*******************************************************************************
+ * @brief  Turns overwrite mode on or off
+ *
+ * @details In overwrite mode Deque_PushBack() on a full deque evicts the
+ *          front element instead of failing, keeping the newest elements as
+ *          a flight recorder would. Ignored by dynamic deques, which grow.
+ *
+ * @param pObj     Pointer to the deque object
+ * @param enabled  true to overwrite, false to fail when full
+ ******************************************************************************/
+void Deque_SetOverwrite(Deque_t *pObj, bool enabled);
+
 /*******************************************************************************
  * @brief  Pushes data onto the back of the deque
  *
- * @details This function is equivalent to a Queue_Push()
+ * @details This function is equivalent to a Queue_Push(). In overwrite mode
+ *          a full deque drops its front element to make room.
  *
  * @param pObj         Pointer to the deque object
  * @param pDataInVoid  Pointer to the data that will be pushed
@@ -76,6 +195,23 @@ Deque_Error_e Deque_PushFront(Deque_t *pObj, void *pDataInVoid);
  ******************************************************************************/
 Deque_Error_e Deque_PushBack(Deque_t *pObj, void *pDataInVoid);
 
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque, evicting the front element
+ *         if the deque is full
+ *
+ * @details Evicting costs a single element copy in place of the pop and push
+ *          pair. Works whether or not overwrite mode is set. A dynamic deque
+ *          grows instead and only evicts if it cannot.
+ *
+ * @param pObj             Pointer to the deque object
+ * @param pDataInVoid      Pointer to the data that will be pushed
+ * @param pEvictedOutVoid  Receives the evicted element, may be NULL
+ *
+ * @returns true if the front element was evicted
+ ******************************************************************************/
+bool Deque_PushBackOverwrite(Deque_t *pObj, void *pDataInVoid,
+                             void *pEvictedOutVoid);
+
 /*******************************************************************************
  * @brief  Pops data member off the front of the deque
  *
@@ -118,5 +254,273 @@ Deque_Error_e Deque_PeekFront(Deque_t *pObj, void *pDataOutVoid);
  ******************************************************************************/
 Deque_Error_e Deque_PeekBack(Deque_t *pObj, void *pDataOutVoid);
 
+/*******************************************************************************
+ * @brief  Peek at any element, counting from the front of the deque
+ *
+ * @param  pObj          Pointer to the deque object
+ * @param  index         Position of the element, 0 is the front element
+ * @param  pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Deque error flag, set if index is past the rear of the deque
+ ******************************************************************************/
+Deque_Error_e Deque_PeekAt(Deque_t *pObj, size_t index, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at any element, counting from the back of the deque
+ *
+ * @param  pObj          Pointer to the deque object
+ * @param  index         Position of the element, 0 is the rear element
+ * @param  pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Deque error flag, set if index is past the front of the deque
+ ******************************************************************************/
+Deque_Error_e Deque_PeekAtBack(Deque_t *pObj, size_t index, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Pushes an array of data onto the front of the deque
+ *
+ * @details The array is copied as a block in at most two segments, and keeps
+ *          its order: pDataInVoid[0] becomes the new front element. This is
+ *          the reverse of calling Deque_PushFront() once per element. Nothing
+ *          is pushed if there is not room for the whole array.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the array of data that will be pushed
+ * @param count        Number of elements in the array
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_PushFrontN(Deque_t *pObj, void *pDataInVoid, size_t count);
+
+/*******************************************************************************
+ * @brief  Pushes an array of data onto the back of the deque
+ *
+ * @details The array is copied as a block in at most two segments. Nothing is
+ *          pushed if there is not room for the whole array.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the array of data that will be pushed
+ * @param count        Number of elements in the array
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_PushBackN(Deque_t *pObj, void *pDataInVoid, size_t count);
+
+/*******************************************************************************
+ * @brief  Pops an array of data members off the front of the deque
+ *
+ * @details Elements are copied out in front to back order. Nothing is popped
+ *          if the deque holds fewer than count elements.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the array that receives the popped data
+ * @param count         Number of elements to pop
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_PopFrontN(Deque_t *pObj, void *pDataOutVoid, size_t count);
+
+/*******************************************************************************
+ * @brief  Pops an array of data members off the rear of the deque
+ *
+ * @details Elements are copied out in front to back order, so the last array
+ *          element is the one that was at the rear. This is the reverse of
+ *          calling Deque_PopBack() once per element. Nothing is popped if the
+ *          deque holds fewer than count elements.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the array that receives the popped data
+ * @param count         Number of elements to pop
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_PopBackN(Deque_t *pObj, void *pDataOutVoid, size_t count);
+
+/*******************************************************************************
+ * @brief  Reserves free space in front of the deque for the caller to fill
+ *
+ * @details Hands out the contiguous run of free elements that ends at the
+ *          front of the deque, so data can be written in place and then
+ *          published with Deque_CommitFront(). The run keeps buffer order:
+ *          once committed, the first element of the run is the new front.
+ *          Committing fewer elements than were reserved publishes the ones
+ *          at the end of the run, nearest the old front.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param count     Number of elements wanted
+ * @param ppDataIn  Set to the start of the reserved run
+ * @param pCount    Set to the number of elements reserved, at most count
+ *
+ * @returns Deque error flag, set if the deque is full
+ ******************************************************************************/
+Deque_Error_e Deque_ReserveFront(Deque_t *pObj, size_t count, void **ppDataIn,
+                                 size_t *pCount);
+
+/*******************************************************************************
+ * @brief  Publishes elements written into space from Deque_ReserveFront()
+ *
+ * @param pObj   Pointer to the deque object
+ * @param count  Number of elements to publish, at most the count reserved
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_CommitFront(Deque_t *pObj, size_t count);
+
+/*******************************************************************************
+ * @brief  Reserves free space at the back of the deque for the caller to fill
+ *
+ * @details Hands out the contiguous run of free elements that starts at the
+ *          rear of the deque, so data can be written in place (e.g. as the
+ *          target of read()) and then published with Deque_CommitBack().
+ *          Nothing is pushed until the commit.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param count     Number of elements wanted
+ * @param ppDataIn  Set to the start of the reserved run
+ * @param pCount    Set to the number of elements reserved, at most count
+ *
+ * @returns Deque error flag, set if the deque is full
+ ******************************************************************************/
+Deque_Error_e Deque_ReserveBack(Deque_t *pObj, size_t count, void **ppDataIn,
+                                size_t *pCount);
+
+/*******************************************************************************
+ * @brief  Publishes elements written into space from Deque_ReserveBack()
+ *
+ * @param pObj   Pointer to the deque object
+ * @param count  Number of elements to publish, at most the count reserved
+ *
+ * @returns Deque error flag
+ ******************************************************************************/
+Deque_Error_e Deque_CommitBack(Deque_t *pObj, size_t count);
+
+/*******************************************************************************
+ * @brief  Get the stored data in place, starting from the front of the deque
+ *
+ * @details The data is returned as at most two runs pointing into the deque
+ *          buffer. spans[0] starts at the front element and spans[1] holds
+ *          whatever wrapped around to the start of the buffer; its count is 0
+ *          if nothing did. Elements within a run are in front to back order.
+ *          The pointers stay valid until the deque is next modified. Use
+ *          Deque_ReleaseFront() to drop the data once it has been consumed.
+ *          A mirrored deque always returns everything in spans[0].
+ *
+ * @param pObj   Pointer to the deque object
+ * @param spans  Array of two spans that receive the runs
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e Deque_PeekFrontSpans(Deque_t *pObj, Deque_Span_t spans[2]);
+
+/*******************************************************************************
+ * @brief  Get the stored data in place, starting from the back of the deque
+ *
+ * @details Same as Deque_PeekFrontSpans(), except spans[0] is the run that
+ *          ends with the rear element and spans[1] is the run before it.
+ *          Elements within a run are still in front to back order.
+ *
+ * @param pObj   Pointer to the deque object
+ * @param spans  Array of two spans that receive the runs
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e Deque_PeekBackSpans(Deque_t *pObj, Deque_Span_t spans[2]);
+
+/*******************************************************************************
+ * @brief  Drops data members off the front of the deque without copying them
+ *
+ * @param pObj   Pointer to the deque object
+ * @param count  Number of elements to drop
+ *
+ * @returns Deque error flag, set if the deque holds fewer than count elements
+ ******************************************************************************/
+Deque_Error_e Deque_ReleaseFront(Deque_t *pObj, size_t count);
+
+/*******************************************************************************
+ * @brief  Drops data members off the rear of the deque without copying them
+ *
+ * @param pObj   Pointer to the deque object
+ * @param count  Number of elements to drop
+ *
+ * @returns Deque error flag, set if the deque holds fewer than count elements
+ ******************************************************************************/
+Deque_Error_e Deque_ReleaseBack(Deque_t *pObj, size_t count);
+
+/*******************************************************************************
+ * @brief  Starts a read-only walk from the front element to the rear element
+ *
+ * @details Elements are returned by Deque_IterNext() as pointers into the
+ *          deque buffer; nothing is copied and the cursors are not touched.
+ *          An element can only be returned in place if it never straddles
+ *          the end of the buffer, so bufSize must be a multiple of dataSize
+ *          unless the deque is mirrored.
+ *
+ * @param pObj   Pointer to the deque object
+ * @param pIter  Pointer to the iterator to set up
+ *
+ * @returns Deque error flag, set if elements can straddle the buffer end.
+ *          The iterator then returns nothing.
+ ******************************************************************************/
+Deque_Error_e Deque_IterBegin(Deque_t *pObj, Deque_Iter_t *pIter);
+
+/*******************************************************************************
+ * @brief  Starts a read-only walk from the rear element to the front element
+ *
+ * @details Same as Deque_IterBegin(), in reverse. Step with Deque_IterPrev().
+ *
+ * @param pObj   Pointer to the deque object
+ * @param pIter  Pointer to the iterator to set up
+ *
+ * @returns Deque error flag, set if elements can straddle the buffer end
+ ******************************************************************************/
+Deque_Error_e Deque_IterBeginBack(Deque_t *pObj, Deque_Iter_t *pIter);
+
+/*******************************************************************************
+ * @brief  Steps an iterator from Deque_IterBegin() towards the rear
+ *
+ * @param pIter  Pointer to the iterator
+ *
+ * @returns Pointer to the element in the deque buffer, NULL past the rear
+ ******************************************************************************/
+void *Deque_IterNext(Deque_Iter_t *pIter);
+
+/*******************************************************************************
+ * @brief  Steps an iterator from Deque_IterBeginBack() towards the front
+ *
+ * @param pIter  Pointer to the iterator
+ *
+ * @returns Pointer to the element in the deque buffer, NULL past the front
+ ******************************************************************************/
+void *Deque_IterPrev(Deque_Iter_t *pIter);
+
+/*******************************************************************************
+ * @brief  Hands each element to a visitor in place, front to back
+ *
+ * @details The deque is not modified. pfnVisit must not modify the deque.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pfnVisit  Visitor, returns false to stop early
+ * @param pCtx      Caller context handed to every call of pfnVisit
+ *
+ * @returns Number of elements visited, including one that stopped the walk
+ ******************************************************************************/
+size_t Deque_ForEach(Deque_t *pObj, Deque_VisitFn_t pfnVisit, void *pCtx);
+
+/*******************************************************************************
+ * @brief  Consumes data off the front of the deque a run at a time, in place
+ *
+ * @details Each contiguous run of stored data (at most two) is handed to
+ *          pfnDrain, which reports how many elements it consumed. The front
+ *          cursor is then advanced once for everything consumed, which is
+ *          cheaper than popping the same elements one by one. pfnDrain must
+ *          not modify the deque.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pfnDrain  Visitor, returns the number of elements it consumed
+ * @param pCtx      Caller context handed to every call of pfnDrain
+ *
+ * @returns Number of elements consumed, 0 if the deque was empty
+ ******************************************************************************/
+size_t Deque_DrainFront(Deque_t *pObj, Deque_DrainFn_t pfnDrain, void *pCtx);
 
 #endif /* DEQUE_H_INCLUDED */
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * @file  deque_copy.h
+ *
+ * @brief Element copy kernels shared by the deque implementations
+ *
+ * @note  Private to the library, not part of the public interface.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_COPY_H_INCLUDED
+#define DEQUE_COPY_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef DEQUE_NO_MEMCPY
+#include <string.h>
+#endif
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Build with DEQUE_NO_MEMCPY defined to keep memcpy() out of the library. The
+ * element kernels then only move whole words when both sides are aligned. */
+#if defined(DEQUE_NO_MEMCPY) && defined(__GNUC__)
+#define DEQUE_WORD_ACCESS
+typedef uint16_t __attribute__((__may_alias__)) Deque_Word16_t;
+typedef uint32_t __attribute__((__may_alias__)) Deque_Word32_t;
+typedef uint64_t __attribute__((__may_alias__)) Deque_Word64_t;
+#endif
+
+/*============================================================================*
+ *                      I N L I N E    F U N C T I O N S                      *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Copies a linear block of bytes
+ ******************************************************************************/
+static inline void Deque_CopyBytes(uint8_t *pDst, const uint8_t *pSrc, size_t size)
+{
+#ifndef DEQUE_NO_MEMCPY
+    memcpy(pDst, pSrc, size);
+#else
+    for (size_t byte = 0; byte < size; byte++)
+    {
+        pDst[byte] = pSrc[byte];
+    }
+#endif
+}
+
+#ifdef DEQUE_WORD_ACCESS
+/*******************************************************************************
+ * @brief  Checks that both pointers are aligned to a power of two width
+ ******************************************************************************/
+static inline bool Deque_IsAligned(const void *pDst, const void *pSrc, size_t width)
+{
+    return ((((uintptr_t)pDst | (uintptr_t)pSrc) & (width - 1)) == 0);
+}
+#endif
+
+/*******************************************************************************
+ * @brief  Copies one element, using a single word move for common widths
+ *
+ * @details The switch hands the compiler a constant size for 1, 2, 4, 8 and 16
+ *          byte elements, so each collapses to one or two load/store pairs.
+ ******************************************************************************/
+static inline void Deque_CopyElement(uint8_t *pDst, const uint8_t *pSrc, size_t size)
+{
+#ifndef DEQUE_NO_MEMCPY
+    switch (size)
+    {
+        case 1:  memcpy(pDst, pSrc, 1);  break;
+        case 2:  memcpy(pDst, pSrc, 2);  break;
+        case 4:  memcpy(pDst, pSrc, 4);  break;
+        case 8:  memcpy(pDst, pSrc, 8);  break;
+        case 16: memcpy(pDst, pSrc, 16); break;
+        default: memcpy(pDst, pSrc, size); break;
+    }
+#elif defined(DEQUE_WORD_ACCESS)
+    if ((size == 2) && Deque_IsAligned(pDst, pSrc, 2))
+    {
+        *(Deque_Word16_t *)pDst = *(const Deque_Word16_t *)pSrc;
+    }
+    else if ((size == 4) && Deque_IsAligned(pDst, pSrc, 4))
+    {
+        *(Deque_Word32_t *)pDst = *(const Deque_Word32_t *)pSrc;
+    }
+    else if ((size == 8) && Deque_IsAligned(pDst, pSrc, 8))
+    {
+        *(Deque_Word64_t *)pDst = *(const Deque_Word64_t *)pSrc;
+    }
+    else if ((size == 16) && Deque_IsAligned(pDst, pSrc, 8))
+    {
+        ((Deque_Word64_t *)pDst)[0] = ((const Deque_Word64_t *)pSrc)[0];
+        ((Deque_Word64_t *)pDst)[1] = ((const Deque_Word64_t *)pSrc)[1];
+    }
+    else
+    {
+        Deque_CopyBytes(pDst, pSrc, size);
+    }
+#else
+    Deque_CopyBytes(pDst, pSrc, size);
+#endif
+}
+
+#endif /* DEQUE_COPY_H_INCLUDED */
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * @file  deque_define.h
+ *
+ * @brief Type safe, statically sized deque generator
+ *
+ * @details DEQUE_DEFINE(Name, T, Capacity) generates a deque object type
+ *          `Name` holding up to Capacity elements of type T, and a set of
+ *          inline functions that mirror deque.h:
+ *
+ *              void          Name_Init(Name *pObj);
+ *              bool          Name_IsEmpty(Name *pObj);
+ *              bool          Name_IsFull(Name *pObj);
+ *              size_t        Name_Count(Name *pObj);
+ *              Deque_Error_e Name_PushFront(Name *pObj, T data);
+ *              Deque_Error_e Name_PushBack(Name *pObj, T data);
+ *              Deque_Error_e Name_PopFront(Name *pObj, T *pDataOut);
+ *              Deque_Error_e Name_PopBack(Name *pObj, T *pDataOut);
+ *              Deque_Error_e Name_PeekFront(Name *pObj, T *pDataOut);
+ *              Deque_Error_e Name_PeekBack(Name *pObj, T *pDataOut);
+ *
+ *          The element size and capacity are compile time constants, so the
+ *          copies become plain assignments and a power of two capacity wraps
+ *          with a mask. Use it at file scope, e.g.
+ *          `DEQUE_DEFINE(SampleQ, sample_t, 1024)`.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_DEFINE_H_INCLUDED
+#define DEQUE_DEFINE_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Wraps an index in [0, 2 * Capacity) back into [0, Capacity)
+**/
+#define DEQUE_DEFINE_WRAP(index, Capacity)                                     \
+    ((((Capacity) & ((Capacity) - 1)) == 0)                                    \
+        ? ((index) & ((Capacity) - 1))                                         \
+        : (((index) >= (Capacity)) ? ((index) - (Capacity)) : (index)))
+
+/**
+ * @brief  Generates a typed deque named Name of Capacity elements of type T
+**/
+#define DEQUE_DEFINE(Name, T, Capacity)                                        \
+                                                                               \
+typedef struct _##Name                                                         \
+{                                                                              \
+    size_t front;           /*!< Index of the front element */                 \
+    size_t count;           /*!< Number of elements in the deque */            \
+    T      buf[(Capacity)]; /*!< Deque buffer */                               \
+} Name;                                                                        \
+                                                                               \
+static inline void Name##_Init(Name *pObj)                                     \
+{                                                                              \
+    pObj->front = 0;                                                           \
+    pObj->count = 0;                                                           \
+}                                                                              \
+                                                                               \
+static inline bool Name##_IsEmpty(Name *pObj)                                  \
+{                                                                              \
+    return (pObj->count == 0);                                                 \
+}                                                                              \
+                                                                               \
+static inline bool Name##_IsFull(Name *pObj)                                   \
+{                                                                              \
+    return (pObj->count == (Capacity));                                        \
+}                                                                              \
+                                                                               \
+static inline size_t Name##_Count(Name *pObj)                                  \
+{                                                                              \
+    return pObj->count;                                                        \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PushFront(Name *pObj, T data)               \
+{                                                                              \
+    Deque_Error_e err = Deque_Error_None;                                      \
+                                                                               \
+    if (Name##_IsFull(pObj))                                                   \
+    {                                                                          \
+        err = Deque_Error;                                                     \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        pObj->front = DEQUE_DEFINE_WRAP(pObj->front + (Capacity) - 1,          \
+                                        (Capacity));                           \
+        pObj->buf[pObj->front] = data;                                         \
+        pObj->count++;                                                         \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PushBack(Name *pObj, T data)                \
+{                                                                              \
+    Deque_Error_e err = Deque_Error_None;                                      \
+                                                                               \
+    if (Name##_IsFull(pObj))                                                   \
+    {                                                                          \
+        err = Deque_Error;                                                     \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        pObj->buf[DEQUE_DEFINE_WRAP(pObj->front + pObj->count,                 \
+                                    (Capacity))] = data;                       \
+        pObj->count++;                                                         \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PeekFront(Name *pObj, T *pDataOut)          \
+{                                                                              \
+    Deque_Error_e err = Deque_Error_None;                                      \
+                                                                               \
+    if (Name##_IsEmpty(pObj))                                                  \
+    {                                                                          \
+        err = Deque_Error;                                                     \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        *pDataOut = pObj->buf[pObj->front];                                    \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PeekBack(Name *pObj, T *pDataOut)           \
+{                                                                              \
+    Deque_Error_e err = Deque_Error_None;                                      \
+                                                                               \
+    if (Name##_IsEmpty(pObj))                                                  \
+    {                                                                          \
+        err = Deque_Error;                                                     \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        *pDataOut = pObj->buf[DEQUE_DEFINE_WRAP(pObj->front + pObj->count - 1, \
+                                                (Capacity))];                  \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PopFront(Name *pObj, T *pDataOut)           \
+{                                                                              \
+    Deque_Error_e err = Name##_PeekFront(pObj, pDataOut);                      \
+                                                                               \
+    if (err == Deque_Error_None)                                               \
+    {                                                                          \
+        pObj->front = DEQUE_DEFINE_WRAP(pObj->front + 1, (Capacity));          \
+        pObj->count--;                                                         \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}                                                                              \
+                                                                               \
+static inline Deque_Error_e Name##_PopBack(Name *pObj, T *pDataOut)            \
+{                                                                              \
+    Deque_Error_e err = Name##_PeekBack(pObj, pDataOut);                       \
+                                                                               \
+    if (err == Deque_Error_None)                                               \
+    {                                                                          \
+        pObj->count--;                                                         \
+    }                                                                          \
+                                                                               \
+    return err;                                                                \
+}
+
+#endif /* DEQUE_DEFINE_H_INCLUDED */
@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * @file  deque_exec.c
+ *
+ * @brief Work stealing task executor implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <sched.h>
+
+#include "deque_exec.h"
+#include "deque.h"
+#include "deque_ws.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Number of failed searches for work before an idle worker parks */
+#define DEQUE_EXEC_SPIN_ROUNDS    64
+
+/*============================================================================*
+ *                          P R I V A T E    D A T A                          *
+ *============================================================================*/
+
+/* Worker running on the current thread, NULL outside of any executor */
+static _Thread_local DequeExec_Worker_t *DequeExec_pCurrent;
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Worker of this executor running on the calling thread, if any
+ ******************************************************************************/
+static DequeExec_Worker_t *DequeExec_Self(DequeExec_t *pObj)
+{
+    DequeExec_Worker_t *pWorker = DequeExec_pCurrent;
+
+    return ((pWorker != NULL) && (pWorker->pExec == pObj)) ? pWorker : NULL;
+}
+
+/*******************************************************************************
+ * @brief  xorshift32 step for picking steal victims
+ ******************************************************************************/
+static uint32_t DequeExec_Random(uint32_t *pSeed)
+{
+    uint32_t x = *pSeed;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pSeed = x;
+
+    return x;
+}
+
+/*******************************************************************************
+ * @brief  Runs a task and signals its group
+ ******************************************************************************/
+static void DequeExec_Run(DequeExec_Task_t *pTask)
+{
+    pTask->pfnRun(pTask->pArg);
+
+    if (pTask->pGroup != NULL)
+    {
+        atomic_fetch_sub_explicit(&pTask->pGroup->pending, 1,
+                                  memory_order_release);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Wakes a parked worker after new work has been published
+ ******************************************************************************/
+static void DequeExec_Notify(DequeExec_t *pObj)
+{
+    atomic_fetch_add(&pObj->epoch, 1);
+
+    if (atomic_load(&pObj->sleepers) > 0)
+    {
+        pthread_mutex_lock(&pObj->lock);
+        pthread_cond_signal(&pObj->wake);
+        pthread_mutex_unlock(&pObj->lock);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Takes a task from the shared submission deque
+ ******************************************************************************/
+static bool DequeExec_TakeInjected(DequeExec_t *pObj, DequeExec_Task_t *pTask)
+{
+    bool found = false;
+
+    if (atomic_load_explicit(&pObj->injected, memory_order_relaxed) > 0)
+    {
+        pthread_mutex_lock(&pObj->lock);
+        if (Deque_PopFront(&pObj->inject, pTask) == Deque_Error_None)
+        {
+            atomic_fetch_sub_explicit(&pObj->injected, 1,
+                                      memory_order_relaxed);
+            found = true;
+        }
+        pthread_mutex_unlock(&pObj->lock);
+    }
+
+    return found;
+}
+
+/*******************************************************************************
+ * @brief  Finds a task: own deque first, then submissions, then stealing
+ ******************************************************************************/
+static bool DequeExec_Find(DequeExec_t *pObj, DequeExec_Worker_t *pSelf,
+                           uint32_t *pSeed, DequeExec_Task_t *pTask)
+{
+    bool found = false;
+
+    if (pSelf != NULL)
+    {
+        found = (DequeWs_PopFront(&pSelf->deque, pTask) == Deque_Error_None);
+    }
+
+    if (!found)
+    {
+        found = DequeExec_TakeInjected(pObj, pTask);
+    }
+
+    if (!found)
+    {
+        size_t start = DequeExec_Random(pSeed) % pObj->workerCount;
+
+        for (size_t i = 0; (i < pObj->workerCount) && !found; i++)
+        {
+            DequeExec_Worker_t *pVictim =
+                &pObj->pWorkers[(start + i) % pObj->workerCount];
+
+            if (pVictim != pSelf)
+            {
+                found = (DequeWs_StealBack(&pVictim->deque, pTask) ==
+                         Deque_Error_None);
+            }
+        }
+    }
+
+    return found;
+}
+
+/*******************************************************************************
+ * @brief  Parks the calling worker until work is published or shutdown
+ ******************************************************************************/
+static void DequeExec_Park(DequeExec_t *pObj, unsigned int epoch)
+{
+    pthread_mutex_lock(&pObj->lock);
+    atomic_fetch_add(&pObj->sleepers, 1);
+
+    while (!atomic_load(&pObj->stop) && (atomic_load(&pObj->epoch) == epoch))
+    {
+        pthread_cond_wait(&pObj->wake, &pObj->lock);
+    }
+
+    atomic_fetch_sub(&pObj->sleepers, 1);
+    pthread_mutex_unlock(&pObj->lock);
+}
+
+/*******************************************************************************
+ * @brief  Worker thread entry point
+ ******************************************************************************/
+static void *DequeExec_WorkerMain(void *pArg)
+{
+    DequeExec_Worker_t *pSelf = (DequeExec_Worker_t *)pArg;
+    DequeExec_t *pObj = pSelf->pExec;
+    DequeExec_Task_t task;
+    unsigned int idle = 0;
+
+    DequeExec_pCurrent = pSelf;
+
+    while (!atomic_load_explicit(&pObj->stop, memory_order_relaxed))
+    {
+        unsigned int epoch = atomic_load(&pObj->epoch);
+
+        if (DequeExec_Find(pObj, pSelf, &pSelf->seed, &task))
+        {
+            DequeExec_Run(&task);
+            idle = 0;
+        }
+        else if (++idle < DEQUE_EXEC_SPIN_ROUNDS)
+        {
+            sched_yield();
+        }
+        else
+        {
+            /* Nothing was published since the epoch was read, so sleep */
+            DequeExec_Park(pObj, epoch);
+            idle = 0;
+        }
+    }
+
+    DequeExec_pCurrent = NULL;
+
+    return NULL;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeExec_Init(DequeExec_t *pObj, DequeExec_Worker_t *pWorkers,
+                             size_t workerCount, void *pTaskBuf,
+                             size_t tasksPerWorker)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t dequeSize = tasksPerWorker * sizeof(DequeExec_Task_t);
+    DequeExec_Task_t *pTasks = (DequeExec_Task_t *)pTaskBuf;
+    size_t started = 0;
+
+    if ((workerCount == 0) || (tasksPerWorker == 0) ||
+        ((tasksPerWorker & (tasksPerWorker - 1)) != 0))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pObj->pWorkers = pWorkers;
+        pObj->workerCount = workerCount;
+        Deque_Init(&pObj->inject, &pTasks[workerCount * tasksPerWorker],
+                   dequeSize, sizeof(DequeExec_Task_t));
+        atomic_init(&pObj->injected, 0);
+        atomic_init(&pObj->epoch, 0);
+        atomic_init(&pObj->sleepers, 0);
+        atomic_init(&pObj->stop, false);
+        pthread_mutex_init(&pObj->lock, NULL);
+        pthread_cond_init(&pObj->wake, NULL);
+
+        for (size_t i = 0; i < workerCount; i++)
+        {
+            DequeWs_Init(&pWorkers[i].deque, &pTasks[i * tasksPerWorker],
+                         dequeSize, sizeof(DequeExec_Task_t));
+            pWorkers[i].pExec = pObj;
+            pWorkers[i].seed = (uint32_t)(i * 2654435761U) | 1U;
+        }
+
+        while ((started < workerCount) && (err == Deque_Error_None))
+        {
+            if (pthread_create(&pWorkers[started].thread, NULL,
+                               DequeExec_WorkerMain, &pWorkers[started]) != 0)
+            {
+                err = Deque_Error;
+            }
+            else
+            {
+                started++;
+            }
+        }
+
+        if (err != Deque_Error_None)
+        {
+            /* Shut down whatever did start */
+            pObj->workerCount = started;
+            DequeExec_Deinit(pObj);
+        }
+    }
+
+    return err;
+}
+
+void DequeExec_Deinit(DequeExec_t *pObj)
+{
+    pthread_mutex_lock(&pObj->lock);
+    atomic_store(&pObj->stop, true);
+    pthread_cond_broadcast(&pObj->wake);
+    pthread_mutex_unlock(&pObj->lock);
+
+    for (size_t i = 0; i < pObj->workerCount; i++)
+    {
+        pthread_join(pObj->pWorkers[i].thread, NULL);
+    }
+
+    pthread_cond_destroy(&pObj->wake);
+    pthread_mutex_destroy(&pObj->lock);
+}
+
+void DequeExec_GroupInit(DequeExec_Group_t *pGroup)
+{
+    atomic_init(&pGroup->pending, 0);
+}
+
+void DequeExec_Spawn(DequeExec_t *pObj, DequeExec_Group_t *pGroup,
+                     DequeExec_Fn_t pfnRun, void *pArg)
+{
+    DequeExec_Task_t task = { .pfnRun = pfnRun, .pArg = pArg,
+                              .pGroup = pGroup };
+    DequeExec_Worker_t *pSelf = DequeExec_Self(pObj);
+    Deque_Error_e err;
+
+    if (pGroup != NULL)
+    {
+        atomic_fetch_add_explicit(&pGroup->pending, 1, memory_order_relaxed);
+    }
+
+    if (pSelf != NULL)
+    {
+        err = DequeWs_PushFront(&pSelf->deque, &task);
+    }
+    else
+    {
+        pthread_mutex_lock(&pObj->lock);
+        err = Deque_PushBack(&pObj->inject, &task);
+        if (err == Deque_Error_None)
+        {
+            atomic_fetch_add_explicit(&pObj->injected, 1,
+                                      memory_order_relaxed);
+        }
+        pthread_mutex_unlock(&pObj->lock);
+    }
+
+    if (err != Deque_Error_None)
+    {
+        /* No room to queue it, run it here instead */
+        DequeExec_Run(&task);
+    }
+    else
+    {
+        DequeExec_Notify(pObj);
+    }
+}
+
+void DequeExec_Join(DequeExec_t *pObj, DequeExec_Group_t *pGroup)
+{
+    DequeExec_Worker_t *pSelf = DequeExec_Self(pObj);
+    uint32_t seed = (uint32_t)(uintptr_t)pGroup | 1U;
+    uint32_t *pSeed = (pSelf != NULL) ? &pSelf->seed : &seed;
+    DequeExec_Task_t task;
+
+    while (atomic_load_explicit(&pGroup->pending, memory_order_acquire) > 0)
+    {
+        if (DequeExec_Find(pObj, pSelf, pSeed, &task))
+        {
+            DequeExec_Run(&task);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
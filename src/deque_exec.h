@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * @file  deque_exec.h
+ *
+ * @brief Work stealing task executor public function declarations
+ *
+ * @details A fixed pool of worker threads, each owning a DequeWs_t. Tasks
+ *          spawned by a worker go on the front of its own deque and are run
+ *          newest first. Idle workers steal the oldest task from a randomly
+ *          chosen worker, and park on a condition variable once there is
+ *          nothing left to steal. Tasks spawned from outside the pool go
+ *          through a shared, locked Deque_t.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_EXEC_H_INCLUDED
+#define DEQUE_EXEC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_exec_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the executor and starts its worker threads
+ *
+ * @details The caller is responsible for allocating the executor object, the
+ *          worker array and the task buffer.
+ *
+ * @param pObj            Pointer to the executor object
+ * @param pWorkers        Pointer to an array of workerCount workers
+ * @param workerCount     Number of worker threads to start
+ * @param pTaskBuf        Pointer to a DequeExec_Task_t aligned buffer of at
+ *                        least DEQUE_EXEC_BUF_SIZE(workerCount,
+ *                        tasksPerWorker) bytes
+ * @param tasksPerWorker  Capacity of each worker deque, must be a power of two
+ *
+ * @returns Deque error flag, set if the arguments are invalid or a thread
+ *          could not be started
+ ******************************************************************************/
+Deque_Error_e DequeExec_Init(DequeExec_t *pObj, DequeExec_Worker_t *pWorkers,
+                             size_t workerCount, void *pTaskBuf,
+                             size_t tasksPerWorker);
+
+/*******************************************************************************
+ * @brief  Stops and joins the worker threads
+ *
+ * @details Tasks still queued are dropped. Join any outstanding groups first.
+ *
+ * @param pObj  Pointer to the executor object
+ ******************************************************************************/
+void DequeExec_Deinit(DequeExec_t *pObj);
+
+/*******************************************************************************
+ * @brief  Initializes a task group
+ *
+ * @param pGroup  Pointer to the group
+ ******************************************************************************/
+void DequeExec_GroupInit(DequeExec_Group_t *pGroup);
+
+/*******************************************************************************
+ * @brief  Spawns a task
+ *
+ * @details From a worker the task goes on the front of that worker's deque,
+ *          otherwise on the shared submission deque. If the deque is full the
+ *          task is run immediately on the calling thread instead.
+ *
+ * @param pObj    Pointer to the executor object
+ * @param pGroup  Group the task belongs to, may be NULL
+ * @param pfnRun  Task entry point
+ * @param pArg    Argument handed to the entry point
+ ******************************************************************************/
+void DequeExec_Spawn(DequeExec_t *pObj, DequeExec_Group_t *pGroup,
+                     DequeExec_Fn_t pfnRun, void *pArg);
+
+/*******************************************************************************
+ * @brief  Waits for every task in a group to finish
+ *
+ * @details The calling thread runs queued tasks while it waits, so this may
+ *          be called from inside a task to fork and join.
+ *
+ * @param pObj    Pointer to the executor object
+ * @param pGroup  Group to wait on
+ ******************************************************************************/
+void DequeExec_Join(DequeExec_t *pObj, DequeExec_Group_t *pGroup);
+
+#endif /* DEQUE_EXEC_H_INCLUDED */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * @file  deque_exec_t.h
+ *
+ * @brief Work stealing task executor type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_EXEC_T_H_INCLUDED
+#define DEQUE_EXEC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "deque_t.h"
+#include "deque_ws_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Size of the task buffer needed by DequeExec_Init()
+ *
+ * @details One deque per worker plus one for tasks submitted from outside
+ *          the executor.
+**/
+#define DEQUE_EXEC_BUF_SIZE(workerCount, tasksPerWorker)                       \
+    (((workerCount) + 1) * (tasksPerWorker) * sizeof(DequeExec_Task_t))
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Task entry point
+**/
+typedef void (*DequeExec_Fn_t)(void *pArg);
+
+/**
+ * @brief  Set of tasks that can be waited on together
+**/
+typedef struct _DequeExec_Group_t
+{
+    atomic_size_t pending; /*!< Number of spawned tasks not yet finished */
+} DequeExec_Group_t;
+
+/**
+ * @brief  Task, as stored in the worker deques
+**/
+typedef struct _DequeExec_Task_t
+{
+    DequeExec_Fn_t     pfnRun; /*!< Task entry point */
+    void              *pArg;   /*!< Argument handed to the entry point */
+    DequeExec_Group_t *pGroup; /*!< Group to notify when done, may be NULL */
+} DequeExec_Task_t;
+
+struct _DequeExec_t;
+
+/**
+ * @brief  Worker thread state
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeExec_Worker_t
+{
+    DequeWs_t            deque;   /*!< Tasks spawned by this worker */
+    struct _DequeExec_t *pExec;   /*!< Owning executor */
+    pthread_t            thread;  /*!< Worker thread */
+    uint32_t             seed;    /*!< Steal victim random number state */
+} DequeExec_Worker_t;
+
+/**
+ * @brief  Work stealing executor object
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeExec_t
+{
+    DequeExec_Worker_t *pWorkers;    /*!< Array of workers */
+    size_t              workerCount; /*!< Number of workers */
+    Deque_t             inject;      /*!< Tasks submitted from other threads */
+    atomic_size_t       injected;    /*!< Number of tasks in inject */
+    pthread_mutex_t     lock;        /*!< Guards inject and parking */
+    pthread_cond_t      wake;        /*!< Signalled when work is published */
+    atomic_uint         epoch;       /*!< Bumped whenever work is published */
+    atomic_uint         sleepers;    /*!< Number of parked workers */
+    atomic_bool         stop;        /*!< Set to shut the workers down */
+} DequeExec_t;
+
+#endif /* DEQUE_EXEC_T_H_INCLUDED */
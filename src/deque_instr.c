@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * @file  deque_instr.c
+ *
+ * @brief Deque latency instrumentation implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <time.h>
+#include <stdatomic.h>
+
+#include "deque_instr.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Histogram of one operation
+**/
+typedef struct _DequeInstr_Hist_t
+{
+    atomic_uint_fast64_t buckets[DEQUE_INSTR_BUCKETS]; /*!< Sample counts */
+    atomic_uint_fast64_t max;                          /*!< Slowest sample */
+} DequeInstr_Hist_t;
+
+/*============================================================================*
+ *                          P R I V A T E    D A T A                          *
+ *============================================================================*/
+
+static DequeInstr_Hist_t DequeInstr_Hists[Deque_Op_Count];
+
+static const char *const DequeInstr_Names[Deque_Op_Count] =
+{
+    [Deque_Op_PushFront]         = "PushFront",
+    [Deque_Op_PushBack]          = "PushBack",
+    [Deque_Op_PopFront]          = "PopFront",
+    [Deque_Op_PopBack]           = "PopBack",
+    [Deque_Op_PeekFront]         = "PeekFront",
+    [Deque_Op_PeekBack]          = "PeekBack",
+    [Deque_Op_PeekAt]            = "PeekAt",
+    [Deque_Op_PeekAtBack]        = "PeekAtBack",
+    [Deque_Op_PushFrontN]        = "PushFrontN",
+    [Deque_Op_PushBackN]         = "PushBackN",
+    [Deque_Op_PopFrontN]         = "PopFrontN",
+    [Deque_Op_PopBackN]          = "PopBackN",
+    [Deque_Op_ReserveFront]      = "ReserveFront",
+    [Deque_Op_CommitFront]       = "CommitFront",
+    [Deque_Op_ReserveBack]       = "ReserveBack",
+    [Deque_Op_CommitBack]        = "CommitBack",
+    [Deque_Op_PeekFrontSpans]    = "PeekFrontSpans",
+    [Deque_Op_PeekBackSpans]     = "PeekBackSpans",
+    [Deque_Op_ReleaseFront]      = "ReleaseFront",
+    [Deque_Op_ReleaseBack]       = "ReleaseBack",
+    [Deque_Op_ForEach]           = "ForEach",
+    [Deque_Op_DrainFront]        = "DrainFront",
+    [Deque_Op_PushBackOverwrite] = "PushBackOverwrite",
+};
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Histogram bucket of a latency
+ ******************************************************************************/
+static size_t DequeInstr_Bucket(uint64_t ns)
+{
+    size_t bucket;
+
+    if (ns < DEQUE_INSTR_SUB_BUCKETS)
+    {
+        bucket = (size_t)ns;
+    }
+    else
+    {
+        /* The top DEQUE_INSTR_SUB_BITS + 1 bits pick the bucket */
+        unsigned msb = 63U - (unsigned)__builtin_clzll(ns);
+        unsigned shift = msb - DEQUE_INSTR_SUB_BITS;
+
+        bucket = ((size_t)(shift + 1U) * DEQUE_INSTR_SUB_BUCKETS) +
+                 (size_t)((ns >> shift) & (DEQUE_INSTR_SUB_BUCKETS - 1U));
+    }
+
+    return bucket;
+}
+
+/*******************************************************************************
+ * @brief  Highest latency that falls in a bucket
+ ******************************************************************************/
+static uint64_t DequeInstr_BucketTop(size_t bucket)
+{
+    uint64_t top;
+
+    if (bucket < DEQUE_INSTR_SUB_BUCKETS)
+    {
+        top = bucket;
+    }
+    else
+    {
+        unsigned shift = (unsigned)(bucket / DEQUE_INSTR_SUB_BUCKETS) - 1U;
+        uint64_t sub = (bucket % DEQUE_INSTR_SUB_BUCKETS) +
+                       DEQUE_INSTR_SUB_BUCKETS;
+
+        top = (sub << shift) + ((UINT64_C(1) << shift) - 1U);
+    }
+
+    return top;
+}
+
+/*******************************************************************************
+ * @brief  Latency below which the given share of samples falls
+ *
+ * @param perMille  Share of the samples, in thousandths
+ ******************************************************************************/
+static uint64_t DequeInstr_Percentile(const uint64_t *pCounts, uint64_t total,
+                                      uint64_t perMille)
+{
+    /* Rank of the sample sitting at the percentile, rounded up */
+    uint64_t rank = ((total * perMille) + 999U) / 1000U;
+    uint64_t seen = 0;
+    size_t bucket = 0;
+
+    while ((bucket < (DEQUE_INSTR_BUCKETS - 1U)) &&
+           ((seen + pCounts[bucket]) < rank))
+    {
+        seen += pCounts[bucket];
+        bucket++;
+    }
+
+    return DequeInstr_BucketTop(bucket);
+}
+
+/*******************************************************************************
+ * @brief  Caps a percentile at the exact maximum
+ ******************************************************************************/
+static uint64_t DequeInstr_Cap(uint64_t value, uint64_t max)
+{
+    return (value > max) ? max : value;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+uint64_t DequeInstr_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * UINT64_C(1000000000)) + (uint64_t)ts.tv_nsec;
+}
+
+void DequeInstr_Record(Deque_Op_e op, uint64_t ns)
+{
+    DequeInstr_Hist_t *pHist = &DequeInstr_Hists[op];
+    uint_fast64_t max = atomic_load_explicit(&pHist->max,
+                                             memory_order_relaxed);
+
+    atomic_fetch_add_explicit(&pHist->buckets[DequeInstr_Bucket(ns)], 1,
+                              memory_order_relaxed);
+
+    while ((ns > max) &&
+           !atomic_compare_exchange_weak_explicit(&pHist->max, &max, ns,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed))
+    {
+    }
+}
+
+void DequeInstr_GetReport(Deque_Op_e op, DequeInstr_Report_t *pReport)
+{
+    DequeInstr_Hist_t *pHist = &DequeInstr_Hists[op];
+    uint64_t counts[DEQUE_INSTR_BUCKETS];
+    uint64_t total = 0;
+
+    /* Copy once so every percentile is taken from the same snapshot */
+    for (size_t bucket = 0; bucket < DEQUE_INSTR_BUCKETS; bucket++)
+    {
+        counts[bucket] = atomic_load_explicit(&pHist->buckets[bucket],
+                                              memory_order_relaxed);
+        total += counts[bucket];
+    }
+
+    pReport->count = total;
+    pReport->max = atomic_load_explicit(&pHist->max, memory_order_relaxed);
+
+    if (total == 0)
+    {
+        pReport->p50 = 0;
+        pReport->p99 = 0;
+        pReport->p999 = 0;
+    }
+    else
+    {
+        pReport->p50 = DequeInstr_Cap(DequeInstr_Percentile(counts, total, 500),
+                                      pReport->max);
+        pReport->p99 = DequeInstr_Cap(DequeInstr_Percentile(counts, total, 990),
+                                      pReport->max);
+        pReport->p999 = DequeInstr_Cap(DequeInstr_Percentile(counts, total,
+                                                             999),
+                                       pReport->max);
+    }
+}
+
+void DequeInstr_Print(FILE *pFile)
+{
+    DequeInstr_Report_t report;
+
+    fprintf(pFile, "%-18s %12s %10s %10s %10s %10s\n", "op", "count",
+            "p50_ns", "p99_ns", "p99.9_ns", "max_ns");
+
+    for (size_t op = 0; op < Deque_Op_Count; op++)
+    {
+        DequeInstr_GetReport((Deque_Op_e)op, &report);
+
+        if (report.count > 0)
+        {
+            fprintf(pFile, "%-18s %12llu %10llu %10llu %10llu %10llu\n",
+                    DequeInstr_Names[op], (unsigned long long)report.count,
+                    (unsigned long long)report.p50,
+                    (unsigned long long)report.p99,
+                    (unsigned long long)report.p999,
+                    (unsigned long long)report.max);
+        }
+    }
+}
+
+void DequeInstr_Reset(void)
+{
+    for (size_t op = 0; op < Deque_Op_Count; op++)
+    {
+        for (size_t bucket = 0; bucket < DEQUE_INSTR_BUCKETS; bucket++)
+        {
+            atomic_store_explicit(&DequeInstr_Hists[op].buckets[bucket], 0,
+                                  memory_order_relaxed);
+        }
+
+        atomic_store_explicit(&DequeInstr_Hists[op].max, 0,
+                              memory_order_relaxed);
+    }
+}
+
+const char *DequeInstr_OpName(Deque_Op_e op)
+{
+    return (op < Deque_Op_Count) ? DequeInstr_Names[op] : "Unknown";
+}
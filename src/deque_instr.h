@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * @file  deque_instr.h
+ *
+ * @brief Deque latency instrumentation public function declarations
+ *
+ * @details Building the library with DEQUE_INSTRUMENT defined makes every
+ *          Deque_* push, pop, peek, bulk, reserve, span and release call
+ *          record its latency in a per-operation histogram. Without it the
+ *          probes compile to nothing and deque.c does not reference this
+ *          module at all. The histograms are shared by all deques and
+ *          threads, and are updated with relaxed atomics.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_INSTR_H_INCLUDED
+#define DEQUE_INSTR_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdio.h>
+#include <stdint.h>
+
+#include "deque_instr_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Probes placed around the body of each instrumented function */
+#ifdef DEQUE_INSTRUMENT
+#define DEQUE_PROBE_BEGIN()                                                    \
+    uint64_t dequeProbeStart = DequeInstr_Now()
+#define DEQUE_PROBE_END(op)                                                    \
+    DequeInstr_Record((op), DequeInstr_Now() - dequeProbeStart)
+#else
+#define DEQUE_PROBE_BEGIN()
+#define DEQUE_PROBE_END(op)
+#endif
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Reads the monotonic clock used by the probes
+ *
+ * @returns Time in nanoseconds
+ ******************************************************************************/
+uint64_t DequeInstr_Now(void);
+
+/*******************************************************************************
+ * @brief  Adds one latency sample to the histogram of an operation
+ *
+ * @param op  Operation that was timed
+ * @param ns  Latency in nanoseconds
+ ******************************************************************************/
+void DequeInstr_Record(Deque_Op_e op, uint64_t ns);
+
+/*******************************************************************************
+ * @brief  Summarizes the histogram of an operation
+ *
+ * @details Safe to call while other threads record, the summary is then a
+ *          close but not exact snapshot.
+ *
+ * @param op       Operation to report on
+ * @param pReport  Pointer to the summary, all zero if nothing was recorded
+ ******************************************************************************/
+void DequeInstr_GetReport(Deque_Op_e op, DequeInstr_Report_t *pReport);
+
+/*******************************************************************************
+ * @brief  Prints a table of every operation with recorded samples
+ *
+ * @param pFile  Stream to print to, e.g. stdout
+ ******************************************************************************/
+void DequeInstr_Print(FILE *pFile);
+
+/*******************************************************************************
+ * @brief  Clears every histogram
+ ******************************************************************************/
+void DequeInstr_Reset(void);
+
+/*******************************************************************************
+ * @brief  Name of an operation, e.g. "PushBack"
+ *
+ * @param op  Operation
+ *
+ * @returns Constant string
+ ******************************************************************************/
+const char *DequeInstr_OpName(Deque_Op_e op);
+
+#endif /* DEQUE_INSTR_H_INCLUDED */
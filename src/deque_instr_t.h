@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * @file  deque_instr_t.h
+ *
+ * @brief Deque latency instrumentation type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_INSTR_T_H_INCLUDED
+#define DEQUE_INSTR_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Log-linear histogram layout
+ *
+ * @details Latencies below DEQUE_INSTR_SUB_BUCKETS ns get a bucket each.
+ *          Above that every power of two range is split into
+ *          DEQUE_INSTR_SUB_BUCKETS equal buckets, so any recorded value is
+ *          within 1/16 (6.25%) of the true one, across the full uint64_t
+ *          range.
+**/
+#define DEQUE_INSTR_SUB_BITS       4U
+#define DEQUE_INSTR_SUB_BUCKETS    (1U << DEQUE_INSTR_SUB_BITS)
+#define DEQUE_INSTR_BUCKETS                                                    \
+    ((64U - DEQUE_INSTR_SUB_BITS + 1U) * DEQUE_INSTR_SUB_BUCKETS)
+
+/*============================================================================*
+ *                           E N U M E R A T I O N S                          *
+ *============================================================================*/
+
+/**
+ * @brief  Instrumented deque operations
+**/
+typedef enum _Deque_Op_e
+{
+    Deque_Op_PushFront = 0,
+    Deque_Op_PushBack,
+    Deque_Op_PopFront,
+    Deque_Op_PopBack,
+    Deque_Op_PeekFront,
+    Deque_Op_PeekBack,
+    Deque_Op_PeekAt,
+    Deque_Op_PeekAtBack,
+    Deque_Op_PushFrontN,
+    Deque_Op_PushBackN,
+    Deque_Op_PopFrontN,
+    Deque_Op_PopBackN,
+    Deque_Op_ReserveFront,
+    Deque_Op_CommitFront,
+    Deque_Op_ReserveBack,
+    Deque_Op_CommitBack,
+    Deque_Op_PeekFrontSpans,
+    Deque_Op_PeekBackSpans,
+    Deque_Op_ReleaseFront,
+    Deque_Op_ReleaseBack,
+    Deque_Op_ForEach,
+    Deque_Op_DrainFront,
+    Deque_Op_PushBackOverwrite,
+    Deque_Op_Count,            /*!< Number of operations, not an operation */
+} Deque_Op_e;
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Latency summary of one operation, all times in nanoseconds
+ *
+ * @details Percentiles are the highest value of the bucket they fall in, so
+ *          they err on the slow side by at most one bucket width.
+**/
+typedef struct _DequeInstr_Report_t
+{
+    uint64_t count; /*!< Number of calls recorded */
+    uint64_t p50;   /*!< Median */
+    uint64_t p99;   /*!< 99th percentile */
+    uint64_t p999;  /*!< 99.9th percentile */
+    uint64_t max;   /*!< Slowest call, exact */
+} DequeInstr_Report_t;
+
+#endif /* DEQUE_INSTR_T_H_INCLUDED */
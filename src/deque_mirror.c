@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * @file  deque_mirror.c
+ *
+ * @brief Mirrored deque buffer set up and tear down
+ *
+ * @details Kept apart from deque.c so that the core stays free of operating
+ *          system calls.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "deque.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+#ifdef __linux__
+/*******************************************************************************
+ * @brief  Smallest multiple of both the page size and dataSize at least
+ *         minSize, or 0 on overflow
+ ******************************************************************************/
+static size_t Deque_MirrorSize(size_t minSize, size_t dataSize)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = (minSize == 0) ? page : minSize;
+
+    if (size > (SIZE_MAX / 2) - page)
+    {
+        size = 0;
+    }
+    else
+    {
+        size = ((size + page - 1) / page) * page;
+
+        /* Stops at a common multiple within dataSize steps */
+        while ((size != 0) && ((size % dataSize) != 0))
+        {
+            size = (size > (SIZE_MAX / 2) - page) ? 0 : (size + page);
+        }
+    }
+
+    return size;
+}
+
+/*******************************************************************************
+ * @brief  Maps a shared memory file twice in a row
+ *
+ * @returns Start of the first mapping, NULL on failure
+ ******************************************************************************/
+static uint8_t *Deque_MirrorMap(size_t size)
+{
+    uint8_t *pBuf = NULL;
+    int fd = memfd_create("deque", MFD_CLOEXEC);
+
+    if ((fd >= 0) && (ftruncate(fd, (off_t)size) == 0))
+    {
+        /* Reserve room for both halves, then map the file over each */
+        void *pBase = mmap(NULL, 2 * size, PROT_NONE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (pBase != MAP_FAILED)
+        {
+            uint8_t *pLow = pBase;
+
+            if ((mmap(pLow, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) ||
+                (mmap(&pLow[size], size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED))
+            {
+                munmap(pBase, 2 * size);
+            }
+            else
+            {
+                pBuf = pLow;
+            }
+        }
+    }
+
+    if (fd >= 0)
+    {
+        /* The mappings keep the memory alive */
+        close(fd);
+    }
+
+    return pBuf;
+}
+#endif
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e Deque_InitMirrored(Deque_t *pObj, size_t minSize,
+                                 size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error;
+
+#ifdef __linux__
+    size_t size = (dataSize == 0) ? 0 : Deque_MirrorSize(minSize, dataSize);
+    uint8_t *pBuf = (size == 0) ? NULL : Deque_MirrorMap(size);
+
+    if (pBuf != NULL)
+    {
+        Deque_Init(pObj, pBuf, size, dataSize);
+        pObj->flags |= DEQUE_FLAG_MIRRORED;
+
+        if ((size & (size - 1)) == 0)
+        {
+            pObj->mask = size - 1;
+        }
+
+        err = Deque_Error_None;
+    }
+#else
+    (void)pObj;
+    (void)minSize;
+    (void)dataSize;
+#endif
+
+    return err;
+}
+
+void Deque_DeinitMirrored(Deque_t *pObj)
+{
+#ifdef __linux__
+    if ((pObj->flags & DEQUE_FLAG_MIRRORED) != 0)
+    {
+        munmap(pObj->pBuf, 2 * pObj->bufSize);
+    }
+#endif
+
+    pObj->pBuf = NULL;
+    pObj->bufSize = 0;
+    pObj->front = SIZE_MAX;
+    pObj->rear = 0;
+    pObj->flags = 0;
+}
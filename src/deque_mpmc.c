@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * @file  deque_mpmc.c
+ *
+ * @brief Multi producer, multi consumer deque implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_mpmc.h"
+#include "deque_copy.h"
+#include "deque_wait.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Signed distance between a slot sequence number and a position
+ ******************************************************************************/
+static intptr_t DequeMpmc_Diff(size_t seq, size_t pos)
+{
+    return (intptr_t)(seq - pos);
+}
+
+/*******************************************************************************
+ * @brief  DequeWait_TryFn_t adapter for DequeMpmc_PushBack()
+ ******************************************************************************/
+static Deque_Error_e DequeMpmc_TryPush(void *pQueue, void *pData)
+{
+    return DequeMpmc_PushBack((DequeMpmc_t *)pQueue, pData);
+}
+
+/*******************************************************************************
+ * @brief  DequeWait_TryFn_t adapter for DequeMpmc_PopFront()
+ ******************************************************************************/
+static Deque_Error_e DequeMpmc_TryPop(void *pQueue, void *pData)
+{
+    return DequeMpmc_PopFront((DequeMpmc_t *)pQueue, pData);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeMpmc_Init(DequeMpmc_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize, DequeMpmc_Seq_t *pSeq)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t slots = (dataSize == 0) ? 0 : (bufSize / dataSize);
+
+    if ((slots == 0) || ((bufSize % dataSize) != 0) ||
+        ((slots & (slots - 1)) != 0))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        atomic_init(&pObj->front, 0);
+        atomic_init(&pObj->rear, 0);
+        pObj->pBuf = pBuf;
+        pObj->pSeq = pSeq;
+        pObj->bufSize = bufSize;
+        pObj->dataSize = dataSize;
+        pObj->mask = slots - 1;
+        DequeWait_Init(&pObj->notEmpty);
+        DequeWait_Init(&pObj->notFull);
+
+        for (size_t slot = 0; slot < slots; slot++)
+        {
+            atomic_init(&pSeq[slot], slot);
+        }
+    }
+
+    return err;
+}
+
+bool DequeMpmc_IsEmpty(DequeMpmc_t *pObj)
+{
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+
+    return (front == rear);
+}
+
+Deque_Error_e DequeMpmc_PushBack(DequeMpmc_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t pos = atomic_load_explicit(&pObj->rear, memory_order_relaxed);
+    size_t slot;
+
+    for (;;)
+    {
+        slot = pos & pObj->mask;
+
+        size_t seq = atomic_load_explicit(&pObj->pSeq[slot],
+                                          memory_order_acquire);
+        intptr_t diff = DequeMpmc_Diff(seq, pos);
+
+        if (diff == 0)
+        {
+            /* Slot is free for this position, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&pObj->rear, &pos,
+                                                      pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* Slot still holds an element from the previous lap */
+            err = Deque_Error;
+            break;
+        }
+        else
+        {
+            /* Another producer claimed this position first */
+            pos = atomic_load_explicit(&pObj->rear, memory_order_relaxed);
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        Deque_CopyElement(&pObj->pBuf[slot * pObj->dataSize],
+                          (uint8_t *)pDataInVoid, pObj->dataSize);
+
+        /* Hand the slot to the consumers */
+        atomic_store_explicit(&pObj->pSeq[slot], pos + 1,
+                              memory_order_release);
+        DequeWait_Notify(&pObj->notEmpty);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeMpmc_PopFront(DequeMpmc_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t pos = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+    size_t slot;
+
+    for (;;)
+    {
+        slot = pos & pObj->mask;
+
+        size_t seq = atomic_load_explicit(&pObj->pSeq[slot],
+                                          memory_order_acquire);
+        intptr_t diff = DequeMpmc_Diff(seq, pos + 1);
+
+        if (diff == 0)
+        {
+            /* Slot is filled for this position, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&pObj->front, &pos,
+                                                      pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* Slot has not been filled yet */
+            err = Deque_Error;
+            break;
+        }
+        else
+        {
+            /* Another consumer claimed this position first */
+            pos = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        Deque_CopyElement((uint8_t *)pDataOutVoid,
+                          &pObj->pBuf[slot * pObj->dataSize], pObj->dataSize);
+
+        /* Hand the slot back to the producers for the next lap */
+        atomic_store_explicit(&pObj->pSeq[slot], pos + pObj->mask + 1,
+                              memory_order_release);
+        DequeWait_Notify(&pObj->notFull);
+    }
+
+    return err;
+}
+
+void DequeMpmc_EnableWait(DequeMpmc_t *pObj)
+{
+    DequeWait_Enable(&pObj->notEmpty);
+    DequeWait_Enable(&pObj->notFull);
+}
+
+Deque_Error_e DequeMpmc_PushBackWait(DequeMpmc_t *pObj, void *pDataInVoid,
+                                     uint32_t timeoutMs)
+{
+    return DequeWait_Until(&pObj->notFull, DequeMpmc_TryPush, pObj,
+                           pDataInVoid, timeoutMs);
+}
+
+Deque_Error_e DequeMpmc_PopFrontWait(DequeMpmc_t *pObj, void *pDataOutVoid,
+                                     uint32_t timeoutMs)
+{
+    return DequeWait_Until(&pObj->notEmpty, DequeMpmc_TryPop, pObj,
+                           pDataOutVoid, timeoutMs);
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * @file  deque_mpmc.h
+ *
+ * @brief Multi producer, multi consumer deque public function declarations
+ *
+ * @details A bounded lock free ring that any number of threads push to the
+ *          back of and pop from the front of.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_MPMC_H_INCLUDED
+#define DEQUE_MPMC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_mpmc_t.h"
+#include "deque_wait.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the deque object
+ *
+ * @details The caller is responsible for allocating the deque object, the
+ *          deque buffer and the sequence buffer. Must be called before the
+ *          deque is shared.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pBuf      Pointer to the deque buffer
+ * @param bufSize   Size of the buffer, must be a power of two multiple of
+ *                  dataSize
+ * @param dataSize  Size of the data type that the deque is handling
+ * @param pSeq      Pointer to DEQUE_MPMC_SEQ_COUNT(bufSize, dataSize)
+ *                  sequence numbers
+ *
+ * @returns Deque error flag, set if the buffer does not hold a power of two
+ *          number of elements
+ ******************************************************************************/
+Deque_Error_e DequeMpmc_Init(DequeMpmc_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize, DequeMpmc_Seq_t *pSeq);
+
+/*******************************************************************************
+ * @brief  Check if the deque is empty
+ *
+ * @details The result is a snapshot, other threads may change it at any time.
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequeMpmc_IsEmpty(DequeMpmc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if the deque is full
+ ******************************************************************************/
+Deque_Error_e DequeMpmc_PushBack(DequeMpmc_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops data member off the front of the deque
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeMpmc_PopFront(DequeMpmc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Lets pushes and pops wake threads sleeping in the *Wait calls
+ *
+ * @details Call after init, before the deque is shared. Once enabled, every
+ *          push and pop, blocking or not, pays a full fence and a load to
+ *          check for sleepers. Without it they stay as cheap as before, and
+ *          the *Wait calls poll with short naps instead of sleeping.
+ *
+ * @param pObj  Pointer to the deque object
+ ******************************************************************************/
+void DequeMpmc_EnableWait(DequeMpmc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque, waiting for room if full
+ *
+ * @details Retries briefly, then sleeps until a pop frees a slot, or polls
+ *          if DequeMpmc_EnableWait() was not called.
+ *          Any number of producers may wait at once.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ * @param timeoutMs    Longest wait in milliseconds, or DEQUE_WAIT_FOREVER
+ *
+ * @returns Deque error flag, set if the deque was still full at the timeout
+ ******************************************************************************/
+Deque_Error_e DequeMpmc_PushBackWait(DequeMpmc_t *pObj, void *pDataInVoid,
+                                     uint32_t timeoutMs);
+
+/*******************************************************************************
+ * @brief  Pops data off the front of the deque, waiting for data if empty
+ *
+ * @details Retries briefly, then sleeps until a push publishes an element,
+ *          or polls if DequeMpmc_EnableWait() was not called.
+ *          Any number of consumers may wait at once.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ * @param timeoutMs     Longest wait in milliseconds, or DEQUE_WAIT_FOREVER
+ *
+ * @returns Deque error flag, set if the deque was still empty at the timeout
+ ******************************************************************************/
+Deque_Error_e DequeMpmc_PopFrontWait(DequeMpmc_t *pObj, void *pDataOutVoid,
+                                     uint32_t timeoutMs);
+
+#endif /* DEQUE_MPMC_H_INCLUDED */
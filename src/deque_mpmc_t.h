@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * @file  deque_mpmc_t.h
+ *
+ * @brief Multi producer, multi consumer deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_MPMC_T_H_INCLUDED
+#define DEQUE_MPMC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "deque_t.h"
+#include "deque_wait_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Number of sequence slots needed for a buffer
+**/
+#define DEQUE_MPMC_SEQ_COUNT(bufSize, dataSize)    ((bufSize) / (dataSize))
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Per element sequence number
+**/
+typedef atomic_size_t DequeMpmc_Seq_t;
+
+/**
+ * @brief  Multi producer, multi consumer deque object
+ *
+ * @details Every element slot has a sequence number that says whose turn it
+ *          is: a producer may fill slot i at position pos once its sequence
+ *          equals pos, and a consumer may empty it once it equals pos + 1.
+ *          Producers and consumers only contend on their own cursor.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeMpmc_t
+{
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t    front;    /*!< Next position to pop */
+
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t    rear;     /*!< Next position to push */
+
+    alignas(DEQUE_CACHE_LINE)
+    uint8_t         *pBuf;     /*!< Pointer to the deque buffer */
+    DequeMpmc_Seq_t *pSeq;     /*!< Pointer to the slot sequence numbers */
+    size_t           bufSize;  /*!< Size of the deque buffer */
+    size_t           dataSize; /*!< Size of the data type stored in the deque */
+    size_t           mask;     /*!< Number of slots - 1 */
+
+    alignas(DEQUE_CACHE_LINE)
+    DequeWait_t      notEmpty; /*!< Consumers blocked on an empty deque */
+    DequeWait_t      notFull;  /*!< Producers blocked on a full deque */
+} DequeMpmc_t;
+
+#endif /* DEQUE_MPMC_T_H_INCLUDED */
@@ -0,0 +1,513 @@
+/*******************************************************************************
+ * @file  deque_persist.c
+ *
+ * @brief Persistent deque implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "deque_persist.h"
+#include "deque.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  32 bit FNV-1a hash of a block of bytes
+ ******************************************************************************/
+static uint32_t DequePersist_Checksum(const void *pData, size_t size)
+{
+    const uint8_t *pBytes = (const uint8_t *)pData;
+    uint32_t hash = 2166136261U;
+
+    for (size_t byte = 0; byte < size; byte++)
+    {
+        hash ^= pBytes[byte];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+ * @brief  Checksum of the header fields before its checksum
+ ******************************************************************************/
+static uint32_t DequePersist_HeaderChecksum(const DequePersist_Header_t *pHdr)
+{
+    return DequePersist_Checksum(pHdr,
+                                 offsetof(DequePersist_Header_t, checksum));
+}
+
+/*******************************************************************************
+ * @brief  Checksum of the cursor slot fields before its checksum
+ ******************************************************************************/
+static uint32_t DequePersist_SlotChecksum(const DequePersist_Cursor_t *pSlot)
+{
+    return DequePersist_Checksum(pSlot,
+                                 offsetof(DequePersist_Cursor_t, checksum));
+}
+
+/*******************************************************************************
+ * @brief  Checks a cursor slot is intact and its cursors fit the deque
+ ******************************************************************************/
+static bool DequePersist_SlotIsValid(DequePersist_t *pObj,
+                                     const DequePersist_Cursor_t *pSlot)
+{
+    uint64_t bufSize = pObj->pHeader->bufSize;
+    uint64_t dataSize = pObj->pHeader->dataSize;
+
+    return (pSlot->checksum == DequePersist_SlotChecksum(pSlot)) &&
+           (pSlot->rear < bufSize) && ((pSlot->rear % dataSize) == 0) &&
+           ((pSlot->front == DEQUE_PERSIST_EMPTY) ||
+            ((pSlot->front < bufSize) && ((pSlot->front % dataSize) == 0)));
+}
+
+/*******************************************************************************
+ * @brief  msync() a byte range of the mapping, widened to whole pages
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Sync(DequePersist_t *pObj, size_t offset,
+                                       size_t size)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset - (offset % page);
+
+    if ((size > 0) &&
+        (msync((uint8_t *)pObj->pHeader + start, offset + size - start,
+               MS_SYNC) != 0))
+    {
+        err = Deque_Error;
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Makes a data range durable, then publishes the cursors
+ *
+ * @details The cursors go to the older slot, which is synced last. A crash at
+ *          any point leaves the newer slot, or the freshly synced one, intact.
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Publish(DequePersist_t *pObj,
+                                          size_t dataOffset, size_t dataSize)
+{
+    Deque_Error_e err;
+
+    err = DequePersist_Sync(pObj, DEQUE_PERSIST_HEADER_SIZE + dataOffset,
+                            dataSize);
+
+    if (err == Deque_Error_None)
+    {
+        DequePersist_Cursor_t *pSlot =
+            &pObj->pHeader->slots[(pObj->seq + 1) & 1];
+
+        pSlot->seq = pObj->seq + 1;
+        pSlot->front = Deque_IsEmpty(&pObj->deque) ? DEQUE_PERSIST_EMPTY
+                                                   : pObj->deque.front;
+        pSlot->rear = pObj->deque.rear;
+        pSlot->reserved = 0;
+        pSlot->checksum = DequePersist_SlotChecksum(pSlot);
+
+        err = DequePersist_Sync(pObj, 0, sizeof(DequePersist_Header_t));
+
+        if (err == Deque_Error_None)
+        {
+            pObj->seq++;
+            pObj->pending = 0;
+            pObj->pubFront = pObj->deque.front;
+            pObj->pubRear = pObj->deque.rear;
+        }
+        else
+        {
+            /* Should the slot still reach the file, recovery skips it and
+             * keeps to the older one */
+            pSlot->checksum = ~pSlot->checksum;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Checks if a slot still holds live data under the published cursors
+ *
+ * @details After a pop the slot is free in memory, but a crash would recover
+ *          the published cursors, which still count it as live. Pushing over
+ *          it before the pop is published would corrupt the recovered deque.
+ ******************************************************************************/
+static bool DequePersist_SlotIsPublished(DequePersist_t *pObj, size_t offset)
+{
+    size_t bufSize = pObj->deque.bufSize;
+    bool live = false;
+
+    if (pObj->pubFront != SIZE_MAX)
+    {
+        size_t used = (pObj->pubRear + bufSize - pObj->pubFront) % bufSize;
+
+        live = (used == 0) ||
+               (((offset + bufSize - pObj->pubFront) % bufSize) < used);
+    }
+
+    return live;
+}
+
+/*******************************************************************************
+ * @brief  Publishes pending pops if a push is about to land on a slot they
+ *         freed
+ *
+ * @param offset  Offset of the slot the push will write
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Prepare(DequePersist_t *pObj, size_t offset)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (!Deque_IsFull(&pObj->deque) &&
+        DequePersist_SlotIsPublished(pObj, offset))
+    {
+        err = DequePersist_Flush(pObj);
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Applies the sync policy after a successful push or pop
+ *
+ * @details If the cursors cannot be published the operation is undone, so a
+ *          failed call leaves the deque as it was and can simply be retried.
+ *
+ * @param front       Front cursor from before the operation
+ * @param rear        Rear cursor from before the operation
+ * @param dataOffset  Offset of the element written into the data area
+ * @param dataSize    Size written, 0 for a pop
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Commit(DequePersist_t *pObj, size_t front,
+                                         size_t rear, size_t dataOffset,
+                                         size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t pending = pObj->pending;
+
+    if (pObj->sync == DequePersist_Sync_Always)
+    {
+        err = DequePersist_Publish(pObj, dataOffset, dataSize);
+    }
+    else if (++pObj->pending >= pObj->batch)
+    {
+        err = DequePersist_Flush(pObj);
+    }
+
+    if (err != Deque_Error_None)
+    {
+        pObj->deque.front = front;
+        pObj->deque.rear = rear;
+        pObj->pending = pending;
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Writes the header and an empty cursor slot into a new file
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Format(DequePersist_t *pObj, size_t bufSize,
+                                         size_t dataSize)
+{
+    DequePersist_Header_t *pHdr = pObj->pHeader;
+
+    pHdr->magic = DEQUE_PERSIST_MAGIC;
+    pHdr->version = DEQUE_PERSIST_VERSION;
+    pHdr->dataSize = dataSize;
+    pHdr->bufSize = bufSize;
+    pHdr->reserved = 0;
+    pHdr->checksum = DequePersist_HeaderChecksum(pHdr);
+
+    for (size_t slot = 0; slot < 2; slot++)
+    {
+        pHdr->slots[slot].seq = 0;
+        pHdr->slots[slot].front = DEQUE_PERSIST_EMPTY;
+        pHdr->slots[slot].rear = 0;
+        pHdr->slots[slot].reserved = 0;
+        pHdr->slots[slot].checksum =
+            DequePersist_SlotChecksum(&pHdr->slots[slot]);
+    }
+
+    return DequePersist_Sync(pObj, 0, sizeof(DequePersist_Header_t));
+}
+
+/*******************************************************************************
+ * @brief  Checks if the header was never written
+ *
+ * @details A crash between sizing a new file and syncing its header leaves a
+ *          correctly sized file of zeros, which is still a new file.
+ ******************************************************************************/
+static bool DequePersist_IsBlank(const DequePersist_Header_t *pHdr)
+{
+    const uint8_t *pBytes = (const uint8_t *)pHdr;
+    bool blank = true;
+
+    for (size_t byte = 0; blank && (byte < sizeof(*pHdr)); byte++)
+    {
+        blank = (pBytes[byte] == 0);
+    }
+
+    return blank;
+}
+
+/*******************************************************************************
+ * @brief  Checks an existing file and restores the newest intact cursors
+ ******************************************************************************/
+static Deque_Error_e DequePersist_Recover(DequePersist_t *pObj,
+                                          size_t bufSize, size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+    DequePersist_Header_t *pHdr = pObj->pHeader;
+    const DequePersist_Cursor_t *pBest = NULL;
+
+    if ((pHdr->magic != DEQUE_PERSIST_MAGIC) ||
+        (pHdr->version != DEQUE_PERSIST_VERSION) ||
+        (pHdr->checksum != DequePersist_HeaderChecksum(pHdr)) ||
+        (pHdr->dataSize != dataSize) || (pHdr->bufSize != bufSize))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        for (size_t slot = 0; slot < 2; slot++)
+        {
+            const DequePersist_Cursor_t *pSlot = &pHdr->slots[slot];
+
+            if (DequePersist_SlotIsValid(pObj, pSlot) &&
+                ((pBest == NULL) || (pSlot->seq > pBest->seq)))
+            {
+                pBest = pSlot;
+            }
+        }
+
+        if (pBest == NULL)
+        {
+            err = Deque_Error;
+        }
+        else
+        {
+            pObj->seq = pBest->seq;
+            pObj->deque.front = (pBest->front == DEQUE_PERSIST_EMPTY)
+                                ? SIZE_MAX : (size_t)pBest->front;
+            pObj->deque.rear = (size_t)pBest->rear;
+            pObj->pubFront = pObj->deque.front;
+            pObj->pubRear = pObj->deque.rear;
+        }
+    }
+
+    return err;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequePersist_Open(DequePersist_t *pObj, const char *pPath,
+                                size_t bufSize, size_t dataSize,
+                                DequePersist_Sync_e sync, size_t batch)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t mapSize = DEQUE_PERSIST_HEADER_SIZE + bufSize;
+    struct stat info;
+    bool isNew = false;
+    void *pMap = MAP_FAILED;
+
+    pObj->fd = -1;
+
+    if ((bufSize == 0) || (dataSize == 0) || ((bufSize % dataSize) != 0) ||
+        (bufSize > (SIZE_MAX - DEQUE_PERSIST_HEADER_SIZE)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pObj->fd = open(pPath, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    }
+
+    if ((pObj->fd < 0) || (fstat(pObj->fd, &info) != 0))
+    {
+        err = Deque_Error;
+    }
+    else if (info.st_size == 0)
+    {
+        isNew = true;
+        if (ftruncate(pObj->fd, (off_t)mapSize) != 0)
+        {
+            err = Deque_Error;
+        }
+    }
+    else if ((uint64_t)info.st_size != mapSize)
+    {
+        err = Deque_Error;
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pMap = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    pObj->fd, 0);
+        if (pMap == MAP_FAILED)
+        {
+            err = Deque_Error;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pObj->pHeader = pMap;
+        pObj->mapSize = mapSize;
+        pObj->sync = sync;
+        pObj->batch = (batch == 0) ? 1 : batch;
+        pObj->pending = 0;
+        pObj->seq = 0;
+        pObj->pubFront = SIZE_MAX;
+        pObj->pubRear = 0;
+        Deque_Init(&pObj->deque, (uint8_t *)pMap + DEQUE_PERSIST_HEADER_SIZE,
+                   bufSize, dataSize);
+
+        isNew = isNew || DequePersist_IsBlank(pObj->pHeader);
+        err = isNew ? DequePersist_Format(pObj, bufSize, dataSize)
+                    : DequePersist_Recover(pObj, bufSize, dataSize);
+    }
+
+    if (err != Deque_Error_None)
+    {
+        if (pMap != MAP_FAILED)
+        {
+            munmap(pMap, mapSize);
+        }
+        if (pObj->fd >= 0)
+        {
+            close(pObj->fd);
+            pObj->fd = -1;
+        }
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePersist_Close(DequePersist_t *pObj)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (pObj->pending > 0)
+    {
+        err = DequePersist_Flush(pObj);
+    }
+
+    munmap(pObj->pHeader, pObj->mapSize);
+    close(pObj->fd);
+    pObj->pHeader = NULL;
+    pObj->fd = -1;
+
+    return err;
+}
+
+Deque_Error_e DequePersist_Flush(DequePersist_t *pObj)
+{
+    return DequePersist_Publish(pObj, 0, pObj->deque.bufSize);
+}
+
+bool DequePersist_IsEmpty(DequePersist_t *pObj)
+{
+    return Deque_IsEmpty(&pObj->deque);
+}
+
+Deque_Error_e DequePersist_PushFront(DequePersist_t *pObj, void *pDataInVoid)
+{
+    Deque_t *pDeque = &pObj->deque;
+    size_t base = Deque_IsEmpty(pDeque) ? pDeque->rear : pDeque->front;
+    Deque_Error_e err = DequePersist_Prepare(pObj,
+        (base + pDeque->bufSize - pDeque->dataSize) % pDeque->bufSize);
+
+    size_t front = pDeque->front;
+    size_t rear = pDeque->rear;
+
+    if (err == Deque_Error_None)
+    {
+        err = Deque_PushFront(pDeque, pDataInVoid);
+    }
+
+    if (err == Deque_Error_None)
+    {
+        err = DequePersist_Commit(pObj, front, rear, pDeque->front,
+                                  pDeque->dataSize);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePersist_PushBack(DequePersist_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = DequePersist_Prepare(pObj, pObj->deque.rear);
+    size_t front = pObj->deque.front;
+    size_t rear = pObj->deque.rear;
+
+    if (err == Deque_Error_None)
+    {
+        err = Deque_PushBack(&pObj->deque, pDataInVoid);
+    }
+
+    if (err == Deque_Error_None)
+    {
+        /* The element ends at the new rear, or at the end of the buffer */
+        size_t end = (pObj->deque.rear == 0) ? pObj->deque.bufSize
+                                             : pObj->deque.rear;
+
+        err = DequePersist_Commit(pObj, front, rear,
+                                  end - pObj->deque.dataSize,
+                                  pObj->deque.dataSize);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePersist_PopFront(DequePersist_t *pObj, void *pDataOutVoid)
+{
+    size_t front = pObj->deque.front;
+    size_t rear = pObj->deque.rear;
+    Deque_Error_e err = Deque_PopFront(&pObj->deque, pDataOutVoid);
+
+    if (err == Deque_Error_None)
+    {
+        err = DequePersist_Commit(pObj, front, rear, 0, 0);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePersist_PopBack(DequePersist_t *pObj, void *pDataOutVoid)
+{
+    size_t front = pObj->deque.front;
+    size_t rear = pObj->deque.rear;
+    Deque_Error_e err = Deque_PopBack(&pObj->deque, pDataOutVoid);
+
+    if (err == Deque_Error_None)
+    {
+        err = DequePersist_Commit(pObj, front, rear, 0, 0);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePersist_PeekFront(DequePersist_t *pObj, void *pDataOutVoid)
+{
+    return Deque_PeekFront(&pObj->deque, pDataOutVoid);
+}
+
+Deque_Error_e DequePersist_PeekBack(DequePersist_t *pObj, void *pDataOutVoid)
+{
+    return Deque_PeekBack(&pObj->deque, pDataOutVoid);
+}
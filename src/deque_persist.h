@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * @file  deque_persist.h
+ *
+ * @brief Persistent deque public function declarations
+ *
+ * @details A fixed size deque whose buffer and cursors live in a memory
+ *          mapped file, so its contents survive a restart or a crash. Data is
+ *          synced before the cursors that make it visible, and the cursors are
+ *          written to alternating slots, so the file always reopens to the
+ *          last published state. Pops are published the same way; a pop that
+ *          was not yet published when the process died is undone on reopen.
+ *          A push that would reuse a slot freed by such a pop publishes the
+ *          pending batch first, so the undone pop still finds its data.
+ *          A push or pop whose sync fails returns an error and is undone in
+ *          memory too, so the call can simply be retried.
+ *
+ *          Requires a POSIX system. Not thread safe.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_PERSIST_H_INCLUDED
+#define DEQUE_PERSIST_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_persist_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Opens a persistent deque, creating the file if it is new or empty
+ *
+ * @details An existing file must have been created with the same bufSize and
+ *          dataSize. Its newest cursor slot with a good checksum is used. A
+ *          correctly sized file of zeros, left by a crash during creation, is
+ *          formatted as new.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pPath     Path of the backing file
+ * @param bufSize   Size of the data area, must be a multiple of dataSize
+ * @param dataSize  Size of the data type that the deque is handling
+ * @param sync      Sync policy
+ * @param batch     Operations per publish with DequePersist_Sync_Batched,
+ *                  ignored otherwise
+ *
+ * @returns Deque error flag, set if the file could not be opened, created or
+ *          mapped, or does not hold a matching, intact deque
+ ******************************************************************************/
+Deque_Error_e DequePersist_Open(DequePersist_t *pObj, const char *pPath,
+                                size_t bufSize, size_t dataSize,
+                                DequePersist_Sync_e sync, size_t batch);
+
+/*******************************************************************************
+ * @brief  Publishes any pending operations and closes the file
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns Deque error flag, set if the final publish failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_Close(DequePersist_t *pObj);
+
+/*******************************************************************************
+ * @brief  Makes every operation so far durable
+ *
+ * @details Syncs the data area, then writes the cursors to the older slot and
+ *          syncs the header.
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns Deque error flag, set if a sync failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_Flush(DequePersist_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the deque is empty
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequePersist_IsEmpty(DequePersist_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the front of the deque
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if the deque is full or a sync failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_PushFront(DequePersist_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if the deque is full or a sync failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_PushBack(DequePersist_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops data off the front of the deque
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty or a sync failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_PopFront(DequePersist_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Pops data off the back of the deque
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty or a sync failed
+ ******************************************************************************/
+Deque_Error_e DequePersist_PopBack(DequePersist_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the next element to be front popped without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequePersist_PeekFront(DequePersist_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the next element to be back popped without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequePersist_PeekBack(DequePersist_t *pObj, void *pDataOutVoid);
+
+#endif /* DEQUE_PERSIST_H_INCLUDED */
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * @file  deque_persist_t.h
+ *
+ * @brief Persistent deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_PERSIST_T_H_INCLUDED
+#define DEQUE_PERSIST_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* "DQPS" read as a little endian word */
+#define DEQUE_PERSIST_MAGIC          0x53505144U
+#define DEQUE_PERSIST_VERSION        1U
+
+/* Bytes before the data in the file, the data stays page aligned */
+#define DEQUE_PERSIST_HEADER_SIZE    4096U
+
+/* Stored in a cursor slot in place of SIZE_MAX for an empty deque */
+#define DEQUE_PERSIST_EMPTY          UINT64_MAX
+
+/*============================================================================*
+ *                           E N U M E R A T I O N S                          *
+ *============================================================================*/
+
+/**
+ * @brief When cursor updates reach the file
+**/
+typedef enum _DequePersist_Sync_e
+{
+    DequePersist_Sync_Always  = 0, /*!< Every push and pop is made durable */
+    DequePersist_Sync_Batched = 1, /*!< Every batch operations, or on flush */
+} DequePersist_Sync_e;
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  One copy of the cursors as stored in the file
+**/
+typedef struct _DequePersist_Cursor_t
+{
+    uint64_t seq;      /*!< Publish count, the highest valid slot wins */
+    uint64_t front;    /*!< Front cursor, DEQUE_PERSIST_EMPTY if empty */
+    uint64_t rear;     /*!< Rear cursor */
+    uint32_t checksum; /*!< Checksum of the fields above */
+    uint32_t reserved; /*!< Zero */
+} DequePersist_Cursor_t;
+
+/**
+ * @brief  Layout of the start of the file
+ *
+ * @details The cursors are written to the two slots in turn, so a write torn
+ *          by a crash only ever damages the newer one.
+**/
+typedef struct _DequePersist_Header_t
+{
+    uint32_t magic;            /*!< DEQUE_PERSIST_MAGIC */
+    uint32_t version;          /*!< DEQUE_PERSIST_VERSION */
+    uint64_t dataSize;         /*!< Size of the data type stored */
+    uint64_t bufSize;          /*!< Size of the data area after the header */
+    uint32_t checksum;         /*!< Checksum of the fields above */
+    uint32_t reserved;         /*!< Zero */
+    DequePersist_Cursor_t slots[2]; /*!< A/B cursor slots */
+} DequePersist_Header_t;
+
+/**
+ * @brief  Persistent deque object
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequePersist_t
+{
+    Deque_t                deque;    /*!< Deque over the mapped data area */
+    DequePersist_Header_t *pHeader;  /*!< Start of the mapped file */
+    size_t                 mapSize;  /*!< Size of the mapped file */
+    int                    fd;       /*!< File descriptor of the file */
+    DequePersist_Sync_e    sync;     /*!< Sync policy */
+    size_t                 batch;    /*!< Operations per batched publish */
+    size_t                 pending;  /*!< Operations not yet published */
+    uint64_t               seq;      /*!< Sequence of the newest cursor slot */
+    size_t                 pubFront; /*!< Front in the newest slot, SIZE_MAX
+                                          if empty */
+    size_t                 pubRear;  /*!< Rear in the newest slot */
+} DequePersist_t;
+
+#endif /* DEQUE_PERSIST_T_H_INCLUDED */
@@ -0,0 +1,329 @@
+/*******************************************************************************
+ * @file  deque_pool.c
+ *
+ * @brief Deque buffer pool implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_pool.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Blocks moved between a thread cache and the global list in one go */
+#define DEQUE_POOL_BATCH    (DEQUE_POOL_CACHE_MAX / 2)
+
+/*============================================================================*
+ *                          P R I V A T E    D A T A                          *
+ *============================================================================*/
+
+/* Caches of the calling thread, one per pool it has used */
+static _Thread_local DequePool_Cache_t
+    DequePool_Caches[DEQUE_POOL_THREAD_CACHES];
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Calling thread's cache for a pool, claiming a free slot if needed
+ *
+ * @returns NULL if every slot is taken by another pool
+ ******************************************************************************/
+static DequePool_Cache_t *DequePool_Cache(DequePool_t *pObj)
+{
+    DequePool_Cache_t *pCache = NULL;
+    DequePool_Cache_t *pUnused = NULL;
+
+    for (size_t i = 0; (i < DEQUE_POOL_THREAD_CACHES) && (pCache == NULL); i++)
+    {
+        if (DequePool_Caches[i].pPool == pObj)
+        {
+            pCache = &DequePool_Caches[i];
+        }
+        else if ((DequePool_Caches[i].pPool == NULL) && (pUnused == NULL))
+        {
+            pUnused = &DequePool_Caches[i];
+        }
+    }
+
+    if ((pCache == NULL) && (pUnused != NULL))
+    {
+        pCache = pUnused;
+        pCache->pPool = pObj;
+        pCache->pHead = NULL;
+        pCache->count = 0;
+
+        /* Have the cache flushed if the thread exits still holding it */
+        pthread_setspecific(pObj->cacheKey, pCache);
+    }
+
+    return pCache;
+}
+
+/*******************************************************************************
+ * @brief  Moves up to count blocks off the front of a list to the global list
+ *
+ * @details Blocks past maxFree go back to the backing hooks, after the lock
+ *          has been dropped.
+ *
+ * @returns The rest of the list
+ ******************************************************************************/
+static DequePool_Block_t *DequePool_Spill(DequePool_t *pObj,
+                                          DequePool_Block_t *pHead,
+                                          size_t count)
+{
+    DequePool_Block_t *pExcess = NULL;
+
+    pthread_mutex_lock(&pObj->lock);
+    while ((count > 0) && (pHead != NULL))
+    {
+        DequePool_Block_t *pBlock = pHead;
+
+        pHead = pBlock->pNext;
+        if (pObj->freeCount < pObj->maxFree)
+        {
+            pBlock->pNext = pObj->pFree;
+            pObj->pFree = pBlock;
+            pObj->freeCount++;
+        }
+        else
+        {
+            pBlock->pNext = pExcess;
+            pExcess = pBlock;
+        }
+        count--;
+    }
+    pthread_mutex_unlock(&pObj->lock);
+
+    while (pExcess != NULL)
+    {
+        DequePool_Block_t *pBlock = pExcess;
+
+        pExcess = pBlock->pNext;
+        pObj->pBacking->pfnFree(pObj->pBacking->pCtx, pBlock, pObj->allocSize);
+    }
+
+    return pHead;
+}
+
+/*******************************************************************************
+ * @brief  Hands a cache back to its pool and frees its slot
+ ******************************************************************************/
+static void DequePool_CacheFlush(DequePool_Cache_t *pCache)
+{
+    (void)DequePool_Spill(pCache->pPool, pCache->pHead, pCache->count);
+    pCache->pPool = NULL;
+    pCache->pHead = NULL;
+    pCache->count = 0;
+}
+
+/*******************************************************************************
+ * @brief  Thread exit destructor of the cache key
+ ******************************************************************************/
+static void DequePool_CacheExit(void *pCacheVoid)
+{
+    DequePool_Cache_t *pCache = (DequePool_Cache_t *)pCacheVoid;
+
+    if (pCache->pPool != NULL)
+    {
+        DequePool_CacheFlush(pCache);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Moves up to a batch of blocks from the global list into a cache
+ ******************************************************************************/
+static void DequePool_Refill(DequePool_t *pObj, DequePool_Cache_t *pCache)
+{
+    pthread_mutex_lock(&pObj->lock);
+    while ((pCache->count < DEQUE_POOL_BATCH) && (pObj->pFree != NULL))
+    {
+        DequePool_Block_t *pBlock = pObj->pFree;
+
+        pObj->pFree = pBlock->pNext;
+        pObj->freeCount--;
+        pBlock->pNext = pCache->pHead;
+        pCache->pHead = pBlock;
+        pCache->count++;
+    }
+    pthread_mutex_unlock(&pObj->lock);
+}
+
+/*******************************************************************************
+ * @brief  Allocation hook, pooled when the size matches
+ ******************************************************************************/
+static void *DequePool_HookAlloc(void *pCtx, size_t size)
+{
+    DequePool_t *pObj = (DequePool_t *)pCtx;
+
+    return (size == pObj->blockSize)
+           ? DequePool_Alloc(pObj)
+           : pObj->pBacking->pfnAlloc(pObj->pBacking->pCtx, size);
+}
+
+/*******************************************************************************
+ * @brief  Release hook, pooled when the size matches
+ ******************************************************************************/
+static void DequePool_HookFree(void *pCtx, void *pMem, size_t size)
+{
+    DequePool_t *pObj = (DequePool_t *)pCtx;
+
+    if (size == pObj->blockSize)
+    {
+        DequePool_Free(pObj, pMem);
+    }
+    else
+    {
+        pObj->pBacking->pfnFree(pObj->pBacking->pCtx, pMem, size);
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequePool_Init(DequePool_t *pObj,
+                             const Deque_Allocator_t *pBacking,
+                             size_t blockSize, size_t maxFree)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((blockSize == 0) || (pthread_mutex_init(&pObj->lock, NULL) != 0))
+    {
+        err = Deque_Error;
+    }
+    else if (pthread_key_create(&pObj->cacheKey, DequePool_CacheExit) != 0)
+    {
+        err = Deque_Error;
+        pthread_mutex_destroy(&pObj->lock);
+    }
+    else
+    {
+        pObj->pFree = NULL;
+        pObj->freeCount = 0;
+        pObj->maxFree = maxFree;
+        pObj->blockSize = blockSize;
+        /* Free blocks hold the list link, so they cannot be any smaller */
+        pObj->allocSize = (blockSize < sizeof(DequePool_Block_t))
+                          ? sizeof(DequePool_Block_t) : blockSize;
+        pObj->pBacking = pBacking;
+        /* The realloc hook is left out, deques fall back to alloc and free
+         * which keeps resized buffers going through the pool */
+        pObj->alloc.pfnAlloc = DequePool_HookAlloc;
+        pObj->alloc.pfnRealloc = NULL;
+        pObj->alloc.pfnFree = DequePool_HookFree;
+        pObj->alloc.pCtx = pObj;
+    }
+
+    return err;
+}
+
+void DequePool_Deinit(DequePool_t *pObj)
+{
+    DequePool_FlushThreadCache(pObj);
+
+    while (pObj->pFree != NULL)
+    {
+        DequePool_Block_t *pBlock = pObj->pFree;
+
+        pObj->pFree = pBlock->pNext;
+        pObj->pBacking->pfnFree(pObj->pBacking->pCtx, pBlock, pObj->allocSize);
+    }
+
+    pObj->freeCount = 0;
+    pthread_key_delete(pObj->cacheKey);
+    pthread_mutex_destroy(&pObj->lock);
+}
+
+const Deque_Allocator_t *DequePool_Allocator(DequePool_t *pObj)
+{
+    return &pObj->alloc;
+}
+
+void *DequePool_Alloc(DequePool_t *pObj)
+{
+    DequePool_Cache_t *pCache = DequePool_Cache(pObj);
+    DequePool_Block_t *pBlock = NULL;
+
+    if ((pCache != NULL) && (pCache->pHead == NULL))
+    {
+        DequePool_Refill(pObj, pCache);
+    }
+
+    if ((pCache != NULL) && (pCache->pHead != NULL))
+    {
+        pBlock = pCache->pHead;
+        pCache->pHead = pBlock->pNext;
+        pCache->count--;
+    }
+    else if (pCache == NULL)
+    {
+        /* No cache slot left on this thread, use the global list directly */
+        pthread_mutex_lock(&pObj->lock);
+        pBlock = pObj->pFree;
+        if (pBlock != NULL)
+        {
+            pObj->pFree = pBlock->pNext;
+            pObj->freeCount--;
+        }
+        pthread_mutex_unlock(&pObj->lock);
+    }
+
+    if (pBlock == NULL)
+    {
+        pBlock = pObj->pBacking->pfnAlloc(pObj->pBacking->pCtx,
+                                          pObj->allocSize);
+    }
+
+    return pBlock;
+}
+
+void DequePool_Free(DequePool_t *pObj, void *pBlockVoid)
+{
+    DequePool_Block_t *pBlock = (DequePool_Block_t *)pBlockVoid;
+    DequePool_Cache_t *pCache = NULL;
+
+    if (pBlock != NULL)
+    {
+        pCache = DequePool_Cache(pObj);
+
+        if (pCache == NULL)
+        {
+            pBlock->pNext = NULL;
+            (void)DequePool_Spill(pObj, pBlock, 1);
+        }
+        else
+        {
+            if (pCache->count == DEQUE_POOL_CACHE_MAX)
+            {
+                pCache->pHead = DequePool_Spill(pObj, pCache->pHead,
+                                                DEQUE_POOL_BATCH);
+                pCache->count -= DEQUE_POOL_BATCH;
+            }
+
+            pBlock->pNext = pCache->pHead;
+            pCache->pHead = pBlock;
+            pCache->count++;
+        }
+    }
+}
+
+void DequePool_FlushThreadCache(DequePool_t *pObj)
+{
+    for (size_t i = 0; i < DEQUE_POOL_THREAD_CACHES; i++)
+    {
+        DequePool_Cache_t *pCache = &DequePool_Caches[i];
+
+        if (pCache->pPool == pObj)
+        {
+            DequePool_CacheFlush(pCache);
+            pthread_setspecific(pObj->cacheKey, NULL);
+        }
+    }
+}
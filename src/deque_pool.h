@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * @file  deque_pool.h
+ *
+ * @brief Deque buffer pool public function declarations
+ *
+ * @details Recycles same sized buffers between short lived dynamic or
+ *          segmented deques. Each thread keeps a small cache of free blocks
+ *          so most allocations take no lock. The cache spills to, and refills
+ *          from, a mutex guarded global free list in batches. Requests of any
+ *          other size go straight to the backing hooks.
+ *
+ *          A thread's cache is flushed automatically when the thread exits.
+ *          DequePool_FlushThreadCache() hands the blocks back sooner.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_POOL_H_INCLUDED
+#define DEQUE_POOL_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+
+#include "deque_pool_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the pool object
+ *
+ * @param pObj       Pointer to the pool object
+ * @param pBacking   Hooks the pooled blocks come from, e.g. &Deque_StdAllocator
+ * @param blockSize  Size of the pooled blocks, e.g. the initial buffer size of
+ *                   a dynamic deque or the chunk size of a segmented deque
+ * @param maxFree    Most free blocks kept on the global list, any more are
+ *                   handed back to pBacking
+ *
+ * @returns Deque error flag, set if blockSize is 0 or the lock could not be
+ *          created
+ ******************************************************************************/
+Deque_Error_e DequePool_Init(DequePool_t *pObj,
+                             const Deque_Allocator_t *pBacking,
+                             size_t blockSize, size_t maxFree);
+
+/*******************************************************************************
+ * @brief  Returns every free block to the backing hooks
+ *
+ * @details Flushes the calling thread's cache first. Every other thread must
+ *          have flushed its cache or exited, and every deque using the pool
+ *          must have been deinitialized.
+ *
+ * @param pObj  Pointer to the pool object
+ ******************************************************************************/
+void DequePool_Deinit(DequePool_t *pObj);
+
+/*******************************************************************************
+ * @brief  Memory hooks that draw from the pool
+ *
+ * @details Pass to Deque_InitDynamic() or DequeSeg_Init(). Valid for as long
+ *          as the pool is.
+ *
+ * @param pObj  Pointer to the pool object
+ *
+ * @returns Pointer to the hooks
+ ******************************************************************************/
+const Deque_Allocator_t *DequePool_Allocator(DequePool_t *pObj);
+
+/*******************************************************************************
+ * @brief  Takes a block from the pool
+ *
+ * @param pObj  Pointer to the pool object
+ *
+ * @returns Pointer to a block of blockSize bytes, NULL if out of memory
+ ******************************************************************************/
+void *DequePool_Alloc(DequePool_t *pObj);
+
+/*******************************************************************************
+ * @brief  Gives a block back to the pool
+ *
+ * @param pObj        Pointer to the pool object
+ * @param pBlockVoid  Block from DequePool_Alloc(), may be NULL
+ ******************************************************************************/
+void DequePool_Free(DequePool_t *pObj, void *pBlockVoid);
+
+/*******************************************************************************
+ * @brief  Moves the calling thread's cached blocks to the global free list
+ *
+ * @param pObj  Pointer to the pool object
+ ******************************************************************************/
+void DequePool_FlushThreadCache(DequePool_t *pObj);
+
+#endif /* DEQUE_POOL_H_INCLUDED */
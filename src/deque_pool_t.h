@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file  deque_pool_t.h
+ *
+ * @brief Deque buffer pool type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_POOL_T_H_INCLUDED
+#define DEQUE_POOL_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <pthread.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Number of pools a thread can keep a cache for at the same time */
+#ifndef DEQUE_POOL_THREAD_CACHES
+#define DEQUE_POOL_THREAD_CACHES 4
+#endif
+
+/* Most blocks a thread cache holds before handing half back to the pool */
+#ifndef DEQUE_POOL_CACHE_MAX
+#define DEQUE_POOL_CACHE_MAX 16
+#endif
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Free block, the link is stored in the block itself
+**/
+typedef struct _DequePool_Block_t
+{
+    struct _DequePool_Block_t *pNext; /*!< Next free block */
+} DequePool_Block_t;
+
+/**
+ * @brief  Blocks of one pool cached by one thread
+**/
+typedef struct _DequePool_Cache_t
+{
+    struct _DequePool_t *pPool;  /*!< Owning pool, NULL if the slot is free */
+    DequePool_Block_t   *pHead;  /*!< Cached blocks */
+    size_t               count;  /*!< Number of cached blocks */
+} DequePool_Cache_t;
+
+/**
+ * @brief  Pool of same sized deque buffers
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequePool_t
+{
+    pthread_mutex_t          lock;      /*!< Guards the global free list */
+    DequePool_Block_t       *pFree;     /*!< Global free list */
+    size_t                   freeCount; /*!< Blocks on the global free list */
+    size_t                   maxFree;   /*!< Most blocks kept on the list */
+    size_t                   blockSize; /*!< Size of the pooled blocks */
+    size_t                   allocSize; /*!< Size asked of the backing hooks */
+    const Deque_Allocator_t *pBacking;  /*!< Hooks blocks come from */
+    Deque_Allocator_t        alloc;     /*!< Hooks handed to the deques */
+    pthread_key_t            cacheKey;  /*!< Flushes a cache at thread exit */
+} DequePool_t;
+
+#endif /* DEQUE_POOL_T_H_INCLUDED */
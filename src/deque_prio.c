@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * @file  deque_prio.c
+ *
+ * @brief Priority lane deque implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_prio.h"
+#include "deque.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Index of the most urgent lane holding data, ready must not be 0
+ ******************************************************************************/
+static uint32_t DequePrio_Top(DequePrio_t *pObj)
+{
+    return 31U - (uint32_t)__builtin_clz(pObj->ready);
+}
+
+/*******************************************************************************
+ * @brief  Pushes onto either end of a lane and marks it ready
+ ******************************************************************************/
+static Deque_Error_e DequePrio_Push(DequePrio_t *pObj, uint32_t prio,
+                                    void *pDataInVoid, bool front)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (prio >= pObj->lanes)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        err = front ? Deque_PushFront(&pObj->pLanes[prio], pDataInVoid)
+                    : Deque_PushBack(&pObj->pLanes[prio], pDataInVoid);
+
+        if (err == Deque_Error_None)
+        {
+            pObj->ready |= 1U << prio;
+        }
+    }
+
+    return err;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequePrio_Init(DequePrio_t *pObj, Deque_t *pLanes,
+                             uint32_t lanes)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((lanes == 0) || (lanes > DEQUE_PRIO_LANES_MAX))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pObj->pLanes = pLanes;
+        pObj->lanes = lanes;
+        pObj->ready = 0;
+
+        /* Lanes may be handed over already holding data */
+        for (uint32_t i = 0; i < lanes; i++)
+        {
+            if (!Deque_IsEmpty(&pLanes[i]))
+            {
+                pObj->ready |= 1U << i;
+            }
+        }
+    }
+
+    return err;
+}
+
+bool DequePrio_IsEmpty(DequePrio_t *pObj)
+{
+    return (pObj->ready == 0);
+}
+
+Deque_Error_e DequePrio_PushBack(DequePrio_t *pObj, uint32_t prio,
+                                 void *pDataInVoid)
+{
+    return DequePrio_Push(pObj, prio, pDataInVoid, false);
+}
+
+Deque_Error_e DequePrio_PushFront(DequePrio_t *pObj, uint32_t prio,
+                                  void *pDataInVoid)
+{
+    return DequePrio_Push(pObj, prio, pDataInVoid, true);
+}
+
+Deque_Error_e DequePrio_PopFront(DequePrio_t *pObj, void *pDataOutVoid,
+                                 uint32_t *pPrio)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (DequePrio_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        uint32_t prio = DequePrio_Top(pObj);
+        Deque_t *pLane = &pObj->pLanes[prio];
+
+        err = Deque_PopFront(pLane, pDataOutVoid);
+
+        if (Deque_IsEmpty(pLane))
+        {
+            pObj->ready &= ~(1U << prio);
+        }
+
+        if (pPrio != NULL)
+        {
+            *pPrio = prio;
+        }
+    }
+
+    return err;
+}
+
+Deque_Error_e DequePrio_PeekFront(DequePrio_t *pObj, void *pDataOutVoid,
+                                  uint32_t *pPrio)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (DequePrio_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        uint32_t prio = DequePrio_Top(pObj);
+
+        err = Deque_PeekFront(&pObj->pLanes[prio], pDataOutVoid);
+
+        if (pPrio != NULL)
+        {
+            *pPrio = prio;
+        }
+    }
+
+    return err;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * @file  deque_prio.h
+ *
+ * @brief Priority lane deque public function declarations
+ *
+ * @details Keeps urgent elements ahead of bulk ones. Each priority has its own
+ *          lane, an ordinary Deque_t, and pops always come from the most
+ *          urgent lane holding data. Finding that lane is a single count
+ *          leading zeros on a mask of non-empty lanes, however many lanes
+ *          there are.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_PRIO_H_INCLUDED
+#define DEQUE_PRIO_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "deque_prio_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the priority deque over an array of lanes
+ *
+ * @details The lanes are set up beforehand with any of the Deque_Init
+ *          functions, so each priority can have its own size or be dynamic.
+ *          Once handed over they must only be used through this object.
+ *
+ * @param pObj    Pointer to the priority deque object
+ * @param pLanes  Array of lanes, the last one being the most urgent
+ * @param lanes   Number of lanes, at most DEQUE_PRIO_LANES_MAX
+ *
+ * @returns Deque error flag, set if the number of lanes is invalid
+ ******************************************************************************/
+Deque_Error_e DequePrio_Init(DequePrio_t *pObj, Deque_t *pLanes,
+                             uint32_t lanes);
+
+/*******************************************************************************
+ * @brief  Check if every lane is empty
+ *
+ * @param pObj  Pointer to the priority deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequePrio_IsEmpty(DequePrio_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of a lane
+ *
+ * @param pObj         Pointer to the priority deque object
+ * @param prio         Lane to push to, higher is more urgent
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if prio is out of range or the lane is full
+ ******************************************************************************/
+Deque_Error_e DequePrio_PushBack(DequePrio_t *pObj, uint32_t prio,
+                                 void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the front of a lane, ahead of its other elements
+ *
+ * @param pObj         Pointer to the priority deque object
+ * @param prio         Lane to push to, higher is more urgent
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if prio is out of range or the lane is full
+ ******************************************************************************/
+Deque_Error_e DequePrio_PushFront(DequePrio_t *pObj, uint32_t prio,
+                                  void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops data off the front of the most urgent lane holding data
+ *
+ * @param pObj          Pointer to the priority deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ * @param pPrio         Receives the lane popped from, may be NULL
+ *
+ * @returns Deque error flag, set if every lane is empty
+ ******************************************************************************/
+Deque_Error_e DequePrio_PopFront(DequePrio_t *pObj, void *pDataOutVoid,
+                                 uint32_t *pPrio);
+
+/*******************************************************************************
+ * @brief  Get the data DequePrio_PopFront() would pop, without removing it
+ *
+ * @param pObj          Pointer to the priority deque object
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ * @param pPrio         Receives the lane peeked at, may be NULL
+ *
+ * @returns Deque error flag, set if every lane is empty
+ ******************************************************************************/
+Deque_Error_e DequePrio_PeekFront(DequePrio_t *pObj, void *pDataOutVoid,
+                                  uint32_t *pPrio);
+
+#endif /* DEQUE_PRIO_H_INCLUDED */
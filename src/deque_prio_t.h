@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * @file  deque_prio_t.h
+ *
+ * @brief Priority lane deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_PRIO_T_H_INCLUDED
+#define DEQUE_PRIO_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdint.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* One bit of the ready mask per lane */
+#define DEQUE_PRIO_LANES_MAX    32U
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Priority lane deque object
+ *
+ * @details One Deque_t per priority, lane 0 being the least urgent. Bit n of
+ *          ready is set while lane n holds data, so the most urgent lane
+ *          with data is found from the ready mask alone.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequePrio_t
+{
+    Deque_t *pLanes; /*!< Caller's lanes, indexed by priority */
+    uint32_t lanes;  /*!< Number of lanes */
+    uint32_t ready;  /*!< Bit n set while lane n is not empty */
+} DequePrio_t;
+
+#endif /* DEQUE_PRIO_T_H_INCLUDED */
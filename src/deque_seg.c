@@ -0,0 +1,421 @@
+/*******************************************************************************
+ * @file  deque_seg.c
+ *
+ * @brief Segmented deque implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_seg.h"
+#include "deque_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Map slot of the chunk index places after the first chunk in use
+ ******************************************************************************/
+static size_t DequeSeg_MapSlot(DequeSeg_t *pObj, size_t index)
+{
+    return (pObj->mapFront + index) & (pObj->mapSize - 1);
+}
+
+/*******************************************************************************
+ * @brief  Pointer to the chunk index places after the first chunk in use
+ ******************************************************************************/
+static uint8_t *DequeSeg_Chunk(DequeSeg_t *pObj, size_t index)
+{
+    return pObj->ppMap[DequeSeg_MapSlot(pObj, index)];
+}
+
+/*******************************************************************************
+ * @brief  Takes the spare chunk, or allocates a new one
+ ******************************************************************************/
+static uint8_t *DequeSeg_ChunkAlloc(DequeSeg_t *pObj)
+{
+    uint8_t *pChunk = pObj->pSpare;
+
+    if (pChunk != NULL)
+    {
+        pObj->pSpare = NULL;
+    }
+    else
+    {
+        pChunk = pObj->pAlloc->pfnAlloc(pObj->pAlloc->pCtx, pObj->chunkSize);
+    }
+
+    return pChunk;
+}
+
+/*******************************************************************************
+ * @brief  Keeps a chunk as the spare, or frees it if there already is one
+ ******************************************************************************/
+static void DequeSeg_ChunkFree(DequeSeg_t *pObj, uint8_t *pChunk)
+{
+    if (pObj->pSpare == NULL)
+    {
+        pObj->pSpare = pChunk;
+    }
+    else
+    {
+        pObj->pAlloc->pfnFree(pObj->pAlloc->pCtx, pChunk, pObj->chunkSize);
+    }
+}
+
+/*******************************************************************************
+ * @brief  Makes sure the map has a free slot for one more chunk
+ *
+ * @details A full map is doubled, and the chunk pointers are copied to the
+ *          start of the new map in order. The chunks themselves stay put.
+ ******************************************************************************/
+static Deque_Error_e DequeSeg_MapReserve(DequeSeg_t *pObj)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (pObj->chunks == pObj->mapSize)
+    {
+        const Deque_Allocator_t *pAlloc = pObj->pAlloc;
+        size_t oldBytes = pObj->mapSize * sizeof(pObj->ppMap[0]);
+        uint8_t **ppNew = NULL;
+
+        if (pObj->mapSize <= (SIZE_MAX / 2 / sizeof(pObj->ppMap[0])))
+        {
+            ppNew = pAlloc->pfnAlloc(pAlloc->pCtx, oldBytes * 2);
+        }
+
+        if (ppNew == NULL)
+        {
+            err = Deque_Error;
+        }
+        else
+        {
+            for (size_t chunk = 0; chunk < pObj->chunks; chunk++)
+            {
+                ppNew[chunk] = DequeSeg_Chunk(pObj, chunk);
+            }
+
+            pAlloc->pfnFree(pAlloc->pCtx, pObj->ppMap, oldBytes);
+            pObj->ppMap = ppNew;
+            pObj->mapSize *= 2;
+            pObj->mapFront = 0;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Adds a chunk before the first chunk in use
+ ******************************************************************************/
+static Deque_Error_e DequeSeg_AddFrontChunk(DequeSeg_t *pObj)
+{
+    Deque_Error_e err = DequeSeg_MapReserve(pObj);
+    uint8_t *pChunk = NULL;
+
+    if (err == Deque_Error_None)
+    {
+        pChunk = DequeSeg_ChunkAlloc(pObj);
+        if (pChunk == NULL)
+        {
+            err = Deque_Error;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pObj->mapFront = DequeSeg_MapSlot(pObj, pObj->mapSize - 1);
+        pObj->ppMap[pObj->mapFront] = pChunk;
+        pObj->chunks++;
+        pObj->frontOff = pObj->chunkSize;
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Adds a chunk after the last chunk in use
+ ******************************************************************************/
+static Deque_Error_e DequeSeg_AddRearChunk(DequeSeg_t *pObj)
+{
+    Deque_Error_e err = DequeSeg_MapReserve(pObj);
+    uint8_t *pChunk = NULL;
+
+    if (err == Deque_Error_None)
+    {
+        pChunk = DequeSeg_ChunkAlloc(pObj);
+        if (pChunk == NULL)
+        {
+            err = Deque_Error;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pObj->ppMap[DequeSeg_MapSlot(pObj, pObj->chunks)] = pChunk;
+        pObj->chunks++;
+        pObj->rearOff = 0;
+    }
+
+    return err;
+}
+
+/*******************************************************************************
+ * @brief  Drops the last chunk once nothing is left in the deque
+ *
+ * @details The offsets are left stale, the next push starts a fresh chunk
+ *          and sets them up for whichever end it is made at.
+ ******************************************************************************/
+static void DequeSeg_DropLastChunk(DequeSeg_t *pObj)
+{
+    DequeSeg_ChunkFree(pObj, DequeSeg_Chunk(pObj, 0));
+    pObj->chunks = 0;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeSeg_Init(DequeSeg_t *pObj, const Deque_Allocator_t *pAlloc,
+                            size_t perChunk, size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    pObj->ppMap = NULL;
+
+    if ((perChunk == 0) || (dataSize == 0) ||
+        (perChunk > (SIZE_MAX / dataSize)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        pObj->ppMap = pAlloc->pfnAlloc(pAlloc->pCtx, DEQUE_SEG_MAP_MIN *
+                                                     sizeof(pObj->ppMap[0]));
+        if (pObj->ppMap == NULL)
+        {
+            err = Deque_Error;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pObj->mapSize = DEQUE_SEG_MAP_MIN;
+        pObj->mapFront = 0;
+        pObj->chunks = 0;
+        pObj->frontOff = 0;
+        pObj->rearOff = 0;
+        pObj->count = 0;
+        pObj->pSpare = NULL;
+        pObj->chunkSize = perChunk * dataSize;
+        pObj->dataSize = dataSize;
+        pObj->pAlloc = pAlloc;
+    }
+
+    return err;
+}
+
+void DequeSeg_Deinit(DequeSeg_t *pObj)
+{
+    const Deque_Allocator_t *pAlloc = pObj->pAlloc;
+
+    if (pObj->ppMap != NULL)
+    {
+        for (size_t chunk = 0; chunk < pObj->chunks; chunk++)
+        {
+            pAlloc->pfnFree(pAlloc->pCtx, DequeSeg_Chunk(pObj, chunk),
+                            pObj->chunkSize);
+        }
+
+        if (pObj->pSpare != NULL)
+        {
+            pAlloc->pfnFree(pAlloc->pCtx, pObj->pSpare, pObj->chunkSize);
+        }
+
+        pAlloc->pfnFree(pAlloc->pCtx, pObj->ppMap,
+                        pObj->mapSize * sizeof(pObj->ppMap[0]));
+    }
+
+    pObj->ppMap = NULL;
+    pObj->chunks = 0;
+    pObj->count = 0;
+    pObj->pSpare = NULL;
+}
+
+bool DequeSeg_IsEmpty(DequeSeg_t *pObj)
+{
+    return (pObj->count == 0);
+}
+
+Deque_Error_e DequeSeg_PushFront(DequeSeg_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((pObj->chunks == 0) || (pObj->frontOff == 0))
+    {
+        err = DequeSeg_AddFrontChunk(pObj);
+
+        if ((err == Deque_Error_None) && (pObj->chunks == 1))
+        {
+            /* Only chunk, so the rear starts where the front does */
+            pObj->rearOff = pObj->chunkSize;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        pObj->frontOff -= pObj->dataSize;
+        Deque_CopyElement(&DequeSeg_Chunk(pObj, 0)[pObj->frontOff],
+                          (uint8_t *)pDataInVoid, pObj->dataSize);
+        pObj->count++;
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSeg_PushBack(DequeSeg_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((pObj->chunks == 0) || (pObj->rearOff == pObj->chunkSize))
+    {
+        err = DequeSeg_AddRearChunk(pObj);
+
+        if ((err == Deque_Error_None) && (pObj->chunks == 1))
+        {
+            /* Only chunk, so the front starts where the rear does */
+            pObj->frontOff = 0;
+        }
+    }
+
+    if (err == Deque_Error_None)
+    {
+        uint8_t *pRear = DequeSeg_Chunk(pObj, pObj->chunks - 1);
+
+        Deque_CopyElement(&pRear[pObj->rearOff], (uint8_t *)pDataInVoid,
+                          pObj->dataSize);
+        pObj->rearOff += pObj->dataSize;
+        pObj->count++;
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSeg_PopFront(DequeSeg_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (DequeSeg_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_CopyElement((uint8_t *)pDataOutVoid,
+                          &DequeSeg_Chunk(pObj, 0)[pObj->frontOff],
+                          pObj->dataSize);
+        pObj->frontOff += pObj->dataSize;
+        pObj->count--;
+
+        if (pObj->count == 0)
+        {
+            DequeSeg_DropLastChunk(pObj);
+        }
+        else if (pObj->frontOff == pObj->chunkSize)
+        {
+            /* First chunk used up, move on to the next one */
+            DequeSeg_ChunkFree(pObj, DequeSeg_Chunk(pObj, 0));
+            pObj->mapFront = DequeSeg_MapSlot(pObj, 1);
+            pObj->chunks--;
+            pObj->frontOff = 0;
+        }
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSeg_PopBack(DequeSeg_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (DequeSeg_IsEmpty(pObj))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        uint8_t *pRear = DequeSeg_Chunk(pObj, pObj->chunks - 1);
+
+        pObj->rearOff -= pObj->dataSize;
+        Deque_CopyElement((uint8_t *)pDataOutVoid, &pRear[pObj->rearOff],
+                          pObj->dataSize);
+        pObj->count--;
+
+        if (pObj->count == 0)
+        {
+            DequeSeg_DropLastChunk(pObj);
+        }
+        else if (pObj->rearOff == 0)
+        {
+            /* Last chunk used up, move back to the one before it */
+            DequeSeg_ChunkFree(pObj, pRear);
+            pObj->chunks--;
+            pObj->rearOff = pObj->chunkSize;
+        }
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSeg_PeekFront(DequeSeg_t *pObj, void *pDataOutVoid)
+{
+    return DequeSeg_PeekAt(pObj, 0, pDataOutVoid);
+}
+
+Deque_Error_e DequeSeg_PeekBack(DequeSeg_t *pObj, void *pDataOutVoid)
+{
+    return DequeSeg_PeekAtBack(pObj, 0, pDataOutVoid);
+}
+
+Deque_Error_e DequeSeg_PeekAt(DequeSeg_t *pObj, size_t index,
+                              void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (index >= pObj->count)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* Cannot overflow, it is within the bytes held by the chunks in use */
+        size_t offset = pObj->frontOff + (index * pObj->dataSize);
+
+        Deque_CopyElement((uint8_t *)pDataOutVoid,
+                          &DequeSeg_Chunk(pObj, offset / pObj->chunkSize)
+                              [offset % pObj->chunkSize],
+                          pObj->dataSize);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSeg_PeekAtBack(DequeSeg_t *pObj, size_t index,
+                                  void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if (index >= pObj->count)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        err = DequeSeg_PeekAt(pObj, pObj->count - 1 - index, pDataOutVoid);
+    }
+
+    return err;
+}
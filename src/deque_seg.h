@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * @file  deque_seg.h
+ *
+ * @brief Segmented deque public function declarations
+ *
+ * @details An unbounded deque built from fixed size chunks, in the style of a
+ *          block map. Growing at either end costs at most one chunk
+ *          allocation and, rarely, a copy of the chunk pointer map. Elements
+ *          are never relocated, so there are no growth stalls proportional to
+ *          the number of elements held.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_SEG_H_INCLUDED
+#define DEQUE_SEG_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_seg_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the deque object
+ *
+ * @details The caller is responsible for allocating the deque object. The
+ *          chunks and chunk map are allocated through pAlloc.
+ *
+ * @param pObj       Pointer to the deque object
+ * @param pAlloc     Memory hooks, e.g. &Deque_StdAllocator. Must outlive the
+ *                   deque
+ * @param perChunk   Number of elements held by each chunk
+ * @param dataSize   Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if the sizes are invalid or the chunk map
+ *          could not be allocated
+ ******************************************************************************/
+Deque_Error_e DequeSeg_Init(DequeSeg_t *pObj, const Deque_Allocator_t *pAlloc,
+                            size_t perChunk, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Releases every chunk and the chunk map
+ *
+ * @param pObj  Pointer to the deque object
+ ******************************************************************************/
+void DequeSeg_Deinit(DequeSeg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the deque is empty
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequeSeg_IsEmpty(DequeSeg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the front of the deque
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if a chunk could not be allocated
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PushFront(DequeSeg_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if a chunk could not be allocated
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PushBack(DequeSeg_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops data off the front of the deque
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PopFront(DequeSeg_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Pops data off the back of the deque
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PopBack(DequeSeg_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the next element to be front popped without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PeekFront(DequeSeg_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the next element to be back popped without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PeekBack(DequeSeg_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the element index places from the front without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param index         0 for the front element, 1 for the next, and so on
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if index is past the last element
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PeekAt(DequeSeg_t *pObj, size_t index,
+                              void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Copies the element index places from the back without removing it
+ *
+ * @param pObj          Pointer to the deque object
+ * @param index         0 for the back element, 1 for the one before, and so on
+ * @param pDataOutVoid  Pointer to the data that will be peeked
+ *
+ * @returns Deque error flag, set if index is past the first element
+ ******************************************************************************/
+Deque_Error_e DequeSeg_PeekAtBack(DequeSeg_t *pObj, size_t index,
+                                  void *pDataOutVoid);
+
+#endif /* DEQUE_SEG_H_INCLUDED */
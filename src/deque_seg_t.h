@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * @file  deque_seg_t.h
+ *
+ * @brief Segmented deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_SEG_T_H_INCLUDED
+#define DEQUE_SEG_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Number of chunk pointers in a new map, doubled whenever it fills up */
+#ifndef DEQUE_SEG_MAP_MIN
+#define DEQUE_SEG_MAP_MIN 8
+#endif
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Segmented deque object
+ *
+ * @details Elements live in fixed size chunks. A circular map of chunk
+ *          pointers keeps the chunks in order, the first one in use sitting
+ *          at mapFront. Elements never move once pushed.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeSeg_t
+{
+    uint8_t **ppMap;      /*!< Circular map of chunk pointers */
+    size_t    mapSize;    /*!< Number of map slots, a power of two */
+    size_t    mapFront;   /*!< Map slot of the first chunk in use */
+    size_t    chunks;     /*!< Number of chunks in use */
+    size_t    frontOff;   /*!< Offset of the front element in the first chunk */
+    size_t    rearOff;    /*!< Offset past the rear element in the last chunk */
+    size_t    count;      /*!< Number of elements in the deque */
+    uint8_t  *pSpare;     /*!< Last freed chunk, kept to avoid thrashing */
+    size_t    chunkSize;  /*!< Size of a chunk in bytes */
+    size_t    dataSize;   /*!< Size of the data type stored in the deque */
+    const Deque_Allocator_t *pAlloc; /*!< Memory hooks for chunks and map */
+} DequeSeg_t;
+
+#endif /* DEQUE_SEG_T_H_INCLUDED */
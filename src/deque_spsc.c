@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * @file  deque_spsc.c
+ *
+ * @brief Single producer, single consumer deque implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_spsc.h"
+#include "deque_copy.h"
+#include "deque_wait.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Number of bytes between two cursors
+ ******************************************************************************/
+static size_t DequeSpsc_UsedBytes(DequeSpsc_t *pObj, size_t front, size_t rear)
+{
+    return (rear >= front) ? (rear - front)
+                           : (rear + (2 * pObj->bufSize) - front);
+}
+
+/*******************************************************************************
+ * @brief  Buffer offset of a cursor
+ ******************************************************************************/
+static size_t DequeSpsc_Offset(DequeSpsc_t *pObj, size_t cursor)
+{
+    return (cursor >= pObj->bufSize) ? (cursor - pObj->bufSize) : cursor;
+}
+
+/*******************************************************************************
+ * @brief  Moves a cursor forward by one element
+ ******************************************************************************/
+static size_t DequeSpsc_Next(DequeSpsc_t *pObj, size_t cursor)
+{
+    cursor += pObj->dataSize;
+    if (cursor >= (2 * pObj->bufSize))
+    {
+        cursor = 0;
+    }
+
+    return cursor;
+}
+
+/*******************************************************************************
+ * @brief  DequeWait_TryFn_t adapter for DequeSpsc_PushBack()
+ ******************************************************************************/
+static Deque_Error_e DequeSpsc_TryPush(void *pQueue, void *pData)
+{
+    return DequeSpsc_PushBack((DequeSpsc_t *)pQueue, pData);
+}
+
+/*******************************************************************************
+ * @brief  DequeWait_TryFn_t adapter for DequeSpsc_PopFront()
+ ******************************************************************************/
+static Deque_Error_e DequeSpsc_TryPop(void *pQueue, void *pData)
+{
+    return DequeSpsc_PopFront((DequeSpsc_t *)pQueue, pData);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeSpsc_Init(DequeSpsc_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+
+    if ((dataSize == 0) || (bufSize == 0) || ((bufSize % dataSize) != 0) ||
+        (bufSize > (SIZE_MAX / 2)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        atomic_init(&pObj->front, 0);
+        atomic_init(&pObj->rear, 0);
+        pObj->rearCache = 0;
+        pObj->frontCache = 0;
+        pObj->pBuf = pBuf;
+        pObj->bufSize = bufSize;
+        pObj->dataSize = dataSize;
+        DequeWait_Init(&pObj->notEmpty);
+        DequeWait_Init(&pObj->notFull);
+    }
+
+    return err;
+}
+
+bool DequeSpsc_IsEmpty(DequeSpsc_t *pObj)
+{
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+
+    return (front == rear);
+}
+
+bool DequeSpsc_IsFull(DequeSpsc_t *pObj)
+{
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+
+    return (DequeSpsc_UsedBytes(pObj, front, rear) == pObj->bufSize);
+}
+
+Deque_Error_e DequeSpsc_PushBack(DequeSpsc_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_relaxed);
+
+    if (DequeSpsc_UsedBytes(pObj, pObj->frontCache, rear) == pObj->bufSize)
+    {
+        /* Looks full, refresh the consumer's cursor */
+        pObj->frontCache = atomic_load_explicit(&pObj->front,
+                                                memory_order_acquire);
+    }
+
+    if (DequeSpsc_UsedBytes(pObj, pObj->frontCache, rear) == pObj->bufSize)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_CopyElement(&pObj->pBuf[DequeSpsc_Offset(pObj, rear)],
+                          (uint8_t *)pDataInVoid, pObj->dataSize);
+
+        /* Publish the element to the consumer */
+        atomic_store_explicit(&pObj->rear, DequeSpsc_Next(pObj, rear),
+                              memory_order_release);
+        DequeWait_Notify(&pObj->notEmpty);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSpsc_PeekFront(DequeSpsc_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+
+    if (front == pObj->rearCache)
+    {
+        /* Looks empty, refresh the producer's cursor */
+        pObj->rearCache = atomic_load_explicit(&pObj->rear,
+                                               memory_order_acquire);
+    }
+
+    if (front == pObj->rearCache)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_CopyElement((uint8_t *)pDataOutVoid,
+                          &pObj->pBuf[DequeSpsc_Offset(pObj, front)],
+                          pObj->dataSize);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeSpsc_PopFront(DequeSpsc_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = DequeSpsc_PeekFront(pObj, pDataOutVoid);
+
+    if (err == Deque_Error_None)
+    {
+        size_t front = atomic_load_explicit(&pObj->front,
+                                            memory_order_relaxed);
+
+        /* Hand the slot back to the producer */
+        atomic_store_explicit(&pObj->front, DequeSpsc_Next(pObj, front),
+                              memory_order_release);
+        DequeWait_Notify(&pObj->notFull);
+    }
+
+    return err;
+}
+
+void DequeSpsc_EnableWait(DequeSpsc_t *pObj)
+{
+    DequeWait_Enable(&pObj->notEmpty);
+    DequeWait_Enable(&pObj->notFull);
+}
+
+Deque_Error_e DequeSpsc_PushBackWait(DequeSpsc_t *pObj, void *pDataInVoid,
+                                     uint32_t timeoutMs)
+{
+    return DequeWait_Until(&pObj->notFull, DequeSpsc_TryPush, pObj,
+                           pDataInVoid, timeoutMs);
+}
+
+Deque_Error_e DequeSpsc_PopFrontWait(DequeSpsc_t *pObj, void *pDataOutVoid,
+                                     uint32_t timeoutMs)
+{
+    return DequeWait_Until(&pObj->notEmpty, DequeSpsc_TryPop, pObj,
+                           pDataOutVoid, timeoutMs);
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * @file  deque_spsc.h
+ *
+ * @brief Single producer, single consumer deque public function declarations
+ *
+ * @details A lock free ring that one thread pushes to the back of and one
+ *          other thread pops from the front of. The cursors are published
+ *          with acquire/release atomics, no locks or read-modify-write
+ *          operations are used.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_SPSC_H_INCLUDED
+#define DEQUE_SPSC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_spsc_t.h"
+#include "deque_wait.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the deque object
+ *
+ * @details The caller is responsible for allocating the deque object, and
+ *          deque buffer. Must be called before the deque is shared.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pBuf      Pointer to the deque buffer
+ * @param bufSize   Size of the buffer, must be an integer multiple of dataSize
+ * @param dataSize  Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if bufSize is not a multiple of dataSize or
+ *          is larger than SIZE_MAX / 2
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_Init(DequeSpsc_t *pObj, void *pBuf, size_t bufSize,
+                             size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the deque is empty
+ *
+ * @details The result is a snapshot, the other thread may change it at any
+ *          time.
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequeSpsc_IsEmpty(DequeSpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the deque is full
+ *
+ * @details The result is a snapshot, the other thread may change it at any
+ *          time.
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool DequeSpsc_IsFull(DequeSpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque
+ *
+ * @details Producer thread only.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if the deque is full
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_PushBack(DequeSpsc_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops data member off the front of the deque
+ *
+ * @details Consumer thread only.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_PopFront(DequeSpsc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data at the front of the deque
+ *
+ * @details Consumer thread only.
+ *
+ * @param  pObj          Pointer to the deque object
+ * @param  pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Deque error flag, set if the deque is empty
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_PeekFront(DequeSpsc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Lets pushes and pops wake threads sleeping in the *Wait calls
+ *
+ * @details Call after init, before the deque is shared. Once enabled, every
+ *          push and pop, blocking or not, pays a full fence and a load to
+ *          check for sleepers. Without it they stay as cheap as before, and
+ *          the *Wait calls poll with short naps instead of sleeping.
+ *
+ * @param pObj  Pointer to the deque object
+ ******************************************************************************/
+void DequeSpsc_EnableWait(DequeSpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the back of the deque, waiting for room if full
+ *
+ * @details Retries briefly, then sleeps until a pop frees a slot, or polls
+ *          if DequeSpsc_EnableWait() was not called.
+ *          Producer thread only.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ * @param timeoutMs    Longest wait in milliseconds, or DEQUE_WAIT_FOREVER
+ *
+ * @returns Deque error flag, set if the deque was still full at the timeout
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_PushBackWait(DequeSpsc_t *pObj, void *pDataInVoid,
+                                     uint32_t timeoutMs);
+
+/*******************************************************************************
+ * @brief  Pops data off the front of the deque, waiting for data if empty
+ *
+ * @details Retries briefly, then sleeps until a push publishes an element,
+ *          or polls if DequeSpsc_EnableWait() was not called.
+ *          Consumer thread only.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ * @param timeoutMs     Longest wait in milliseconds, or DEQUE_WAIT_FOREVER
+ *
+ * @returns Deque error flag, set if the deque was still empty at the timeout
+ ******************************************************************************/
+Deque_Error_e DequeSpsc_PopFrontWait(DequeSpsc_t *pObj, void *pDataOutVoid,
+                                     uint32_t timeoutMs);
+
+#endif /* DEQUE_SPSC_H_INCLUDED */
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * @file  deque_spsc_t.h
+ *
+ * @brief Single producer, single consumer deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_SPSC_T_H_INCLUDED
+#define DEQUE_SPSC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "deque_t.h"
+#include "deque_wait_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Single producer, single consumer deque object
+ *
+ * @details The cursors run from 0 to 2 * bufSize so a full and an empty deque
+ *          can be told apart without a stash value. Each side owns a cache
+ *          line holding its cursor and a cached copy of the other side's
+ *          cursor, which is only refreshed when the cached copy says the deque
+ *          is full (producer) or empty (consumer).
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeSpsc_t
+{
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t front;      /*!< Front (read) cursor, owned by the consumer */
+    size_t        rearCache;  /*!< Consumer's copy of the rear cursor */
+
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t rear;       /*!< Rear (write) cursor, owned by the producer */
+    size_t        frontCache; /*!< Producer's copy of the front cursor */
+
+    alignas(DEQUE_CACHE_LINE)
+    uint8_t      *pBuf;       /*!< Pointer to the deque buffer */
+    size_t        bufSize;    /*!< Size of the deque buffer */
+    size_t        dataSize;   /*!< Size of the data type stored in the deque */
+
+    alignas(DEQUE_CACHE_LINE)
+    DequeWait_t   notEmpty;   /*!< Consumers blocked on an empty deque */
+    DequeWait_t   notFull;    /*!< Producers blocked on a full deque */
+} DequeSpsc_t;
+
+#endif /* DEQUE_SPSC_T_H_INCLUDED */
@@ -11,6 +11,7 @@
 /*============================================================================*
  *                              I N C L U D E S                               *
  *============================================================================*/
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -18,6 +19,19 @@
  *                                D E F I N E S                               *
  *============================================================================*/
 
+/**
+ * @brief  Cache line size used to keep concurrently written fields apart
+**/
+#ifndef DEQUE_CACHE_LINE
+#define DEQUE_CACHE_LINE    64
+#endif
+
+/**
+ * @brief  Deque_t flags
+**/
+#define DEQUE_FLAG_MIRRORED    (1U << 0) /*!< Buffer is mapped twice in a row */
+#define DEQUE_FLAG_OVERWRITE   (1U << 1) /*!< Full PushBack evicts the front */
+
 /*============================================================================*
  *                           E N U M E R A T I O N S                          *
  *============================================================================*/
@@ -35,6 +49,40 @@ typedef enum _Deque_Error_e
  *                             S T R U C T U R E S                            *
  *============================================================================*/
 
+/**
+ * @brief  Memory hooks used by dynamic deques
+ *
+ * @details Sizes are passed back to pfnRealloc and pfnFree so that pool or
+ *          arena allocators do not need to track them. pfnRealloc may be NULL,
+ *          in which case pfnAlloc, a copy and pfnFree are used instead.
+**/
+typedef struct _Deque_Allocator_t
+{
+    void *(*pfnAlloc)(void *pCtx, size_t size);                 /*!< Allocate */
+    void *(*pfnRealloc)(void *pCtx, void *pMem, size_t oldSize,
+                        size_t newSize);                        /*!< Resize */
+    void  (*pfnFree)(void *pCtx, void *pMem, size_t size);      /*!< Release */
+    void   *pCtx;             /*!< Caller context handed to every hook */
+} Deque_Allocator_t;
+
+/**
+ * @brief  Operational counters of a deque
+ *
+ * @details Element counts, so a bulk push of n elements adds n. Commits count
+ *          as pushes and releases as pops. Peeks are not counted.
+**/
+typedef struct _Deque_Stats_t
+{
+    uint64_t pushFront; /*!< Elements pushed onto the front */
+    uint64_t pushBack;  /*!< Elements pushed onto the back */
+    uint64_t popFront;  /*!< Elements popped off the front */
+    uint64_t popBack;   /*!< Elements popped off the back */
+    uint64_t pushFails; /*!< Pushes, reserves and commits refused for lack
+                             of room */
+    uint64_t popFails;  /*!< Pops and releases refused for lack of data */
+    size_t   highWater; /*!< Most elements ever held at once */
+} Deque_Stats_t;
+
 /**
  * @brief  Deque Object
  *
@@ -47,6 +95,48 @@ typedef struct _Deque_t
     uint8_t *pBuf;     /*!< Pointer to the deque buffer */
     size_t   bufSize;  /*!< Size of the deque buffer */
     size_t   dataSize; /*!< Size of the data type to be stored in the deque */
+    size_t   mask;     /*!< bufSize - 1 for power of two buffers, otherwise 0 */
+    const Deque_Allocator_t *pAlloc; /*!< Memory hooks, NULL if not dynamic */
+    size_t   minSize;  /*!< Dynamic deques never shrink below this size */
+    uint32_t flags;    /*!< DEQUE_FLAG_* bits */
+    Deque_Stats_t *pStats; /*!< Counters, NULL unless attached */
 } Deque_t;
 
+/**
+ * @brief  Contiguous run of elements inside the deque buffer
+**/
+typedef struct _Deque_Span_t
+{
+    void  *pData; /*!< Pointer to the first element of the run */
+    size_t count; /*!< Number of elements in the run */
+} Deque_Span_t;
+
+/**
+ * @brief  Read-only cursor over the elements of a deque
+ *
+ * @details Set up by Deque_IterBegin() or Deque_IterBeginBack(). Invalidated
+ *          by any change to the deque.
+**/
+typedef struct _Deque_Iter_t
+{
+    Deque_t *pDeque;    /*!< Deque being walked */
+    size_t   cursor;    /*!< Buffer cursor of the next element */
+    size_t   remaining; /*!< Number of elements not yet returned */
+} Deque_Iter_t;
+
+/**
+ * @brief  Visitor handed one element in place by Deque_ForEach()
+ *
+ * @returns true to carry on with the next element, false to stop
+**/
+typedef bool (*Deque_VisitFn_t)(void *pCtx, void *pData);
+
+/**
+ * @brief  Visitor handed one contiguous run of elements by Deque_DrainFront()
+ *
+ * @returns Number of elements consumed from the start of the run. Returning
+ *          fewer than count stops the drain.
+**/
+typedef size_t (*Deque_DrainFn_t)(void *pCtx, void *pData, size_t count);
+
 #endif /* DEQUE_T_H_INCLUDED */
\ No newline at end of file
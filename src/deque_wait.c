@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * @file  deque_wait.c
+ *
+ * @brief Blocking wait implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdbool.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "deque_wait.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#define DEQUE_WAIT_NS_PER_MS    1000000U
+#define DEQUE_WAIT_NS_PER_S     1000000000U
+
+/* Longest nap between checks where there is no futex */
+#define DEQUE_WAIT_NAP_NS       100000U
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Monotonic time in nanoseconds
+ ******************************************************************************/
+static uint64_t DequeWait_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * DEQUE_WAIT_NS_PER_S) + (uint64_t)ts.tv_nsec;
+}
+
+/*******************************************************************************
+ * @brief  Sleeps while the epoch still equals seen, until the deadline
+ *
+ * @param deadline  Monotonic time in ns, UINT64_MAX for none
+ *
+ * @returns false once the deadline has passed
+ ******************************************************************************/
+static bool DequeWait_Sleep(DequeWait_t *pObj, uint32_t seen,
+                            uint64_t deadline)
+{
+    uint64_t now = (deadline == UINT64_MAX) ? 0 : DequeWait_Now();
+    bool inTime = (now < deadline);
+
+    if (inTime)
+    {
+        uint64_t left = deadline - now;
+        struct timespec ts;
+
+#ifdef __linux__
+        if (pObj->enabled)
+        {
+            /* Spurious wakeups and a changed epoch both just return early */
+            ts.tv_sec = (time_t)(left / DEQUE_WAIT_NS_PER_S);
+            ts.tv_nsec = (long)(left % DEQUE_WAIT_NS_PER_S);
+            syscall(SYS_futex, &pObj->epoch, FUTEX_WAIT_PRIVATE, seen,
+                    (deadline == UINT64_MAX) ? NULL : &ts, NULL, 0);
+        }
+        else
+#endif
+        if (atomic_load_explicit(&pObj->epoch, memory_order_relaxed) == seen)
+        {
+            /* Nobody will wake us, come back and look */
+            ts.tv_sec = 0;
+            ts.tv_nsec = (long)((left < DEQUE_WAIT_NAP_NS) ? left
+                                                           : DEQUE_WAIT_NAP_NS);
+            nanosleep(&ts, NULL);
+        }
+    }
+
+    return inTime;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+void DequeWait_Init(DequeWait_t *pObj)
+{
+    atomic_init(&pObj->epoch, 0);
+    atomic_init(&pObj->waiters, 0);
+    pObj->enabled = false;
+}
+
+void DequeWait_Enable(DequeWait_t *pObj)
+{
+    pObj->enabled = true;
+}
+
+Deque_Error_e DequeWait_Until(DequeWait_t *pObj, DequeWait_TryFn_t pfnTry,
+                              void *pQueue, void *pData, uint32_t timeoutMs)
+{
+    Deque_Error_e err = pfnTry(pQueue, pData);
+    uint64_t deadline = UINT64_MAX;
+    bool inTime = true;
+
+    for (uint32_t spin = 0; (spin < DEQUE_WAIT_SPINS) &&
+                            (err != Deque_Error_None); spin++)
+    {
+        err = pfnTry(pQueue, pData);
+    }
+
+    if ((err != Deque_Error_None) && (timeoutMs != DEQUE_WAIT_FOREVER))
+    {
+        deadline = DequeWait_Now() +
+                   ((uint64_t)timeoutMs * DEQUE_WAIT_NS_PER_MS);
+    }
+
+    while ((err != Deque_Error_None) && inTime)
+    {
+        uint32_t seen = atomic_load_explicit(&pObj->epoch,
+                                             memory_order_acquire);
+
+        /* Announce the sleep before the last look, pairs with the fence in
+         * DequeWait_Notify() so either the notifier sees the waiter or the
+         * waiter sees the new state */
+        atomic_fetch_add_explicit(&pObj->waiters, 1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        err = pfnTry(pQueue, pData);
+        if (err != Deque_Error_None)
+        {
+            inTime = DequeWait_Sleep(pObj, seen, deadline);
+        }
+
+        atomic_fetch_sub_explicit(&pObj->waiters, 1, memory_order_relaxed);
+    }
+
+    return err;
+}
+
+void DequeWait_Notify(DequeWait_t *pObj)
+{
+    /* Queues that never block keep the fence off their push and pop */
+    if (pObj->enabled)
+    {
+        atomic_thread_fence(memory_order_seq_cst);
+
+        if (atomic_load_explicit(&pObj->waiters, memory_order_relaxed) != 0)
+        {
+            atomic_fetch_add_explicit(&pObj->epoch, 1, memory_order_release);
+#ifdef __linux__
+            syscall(SYS_futex, &pObj->epoch, FUTEX_WAKE_PRIVATE, 1, NULL,
+                    NULL, 0);
+#endif
+        }
+    }
+}
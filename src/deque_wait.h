@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * @file  deque_wait.h
+ *
+ * @brief Blocking wait public function declarations
+ *
+ * @details Sleep and wake support shared by the blocking calls of the
+ *          concurrent deques. On Linux waiters sleep on a futex, elsewhere
+ *          they fall back to short naps.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_WAIT_H_INCLUDED
+#define DEQUE_WAIT_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdint.h>
+
+#include "deque_t.h"
+#include "deque_wait_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Non-blocking attempt at the operation being waited for
+**/
+typedef Deque_Error_e (*DequeWait_TryFn_t)(void *pQueue, void *pData);
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the wait object
+ *
+ * @param pObj  Pointer to the wait object
+ ******************************************************************************/
+void DequeWait_Init(DequeWait_t *pObj);
+
+/*******************************************************************************
+ * @brief  Lets DequeWait_Notify() wake sleeping waiters
+ *
+ * @details Must be called before the object is shared between threads. Without
+ *          it, notify is free and waiters fall back to polling.
+ *
+ * @param pObj  Pointer to the wait object
+ ******************************************************************************/
+void DequeWait_Enable(DequeWait_t *pObj);
+
+/*******************************************************************************
+ * @brief  Retries an operation until it succeeds or the timeout expires
+ *
+ * @details Spins for DEQUE_WAIT_SPINS attempts, then sleeps until pObj is
+ *          notified and tries again. If pObj is not enabled, it naps and
+ *          tries again instead.
+ *
+ * @param pObj       Pointer to the wait object notified when pfnTry may now
+ *                   succeed
+ * @param pfnTry     Operation to attempt
+ * @param pQueue     First argument to pfnTry
+ * @param pData      Second argument to pfnTry
+ * @param timeoutMs  Milliseconds to wait, or DEQUE_WAIT_FOREVER
+ *
+ * @returns Deque error flag, set if the timeout expired first
+ ******************************************************************************/
+Deque_Error_e DequeWait_Until(DequeWait_t *pObj, DequeWait_TryFn_t pfnTry,
+                              void *pQueue, void *pData, uint32_t timeoutMs);
+
+/*******************************************************************************
+ * @brief  Wakes a waiter, if there is one
+ *
+ * @details Call after the state change a waiter is waiting for has been
+ *          published. Does nothing unless pObj is enabled.
+ *
+ * @param pObj  Pointer to the wait object
+ ******************************************************************************/
+void DequeWait_Notify(DequeWait_t *pObj);
+
+#endif /* DEQUE_WAIT_H_INCLUDED */
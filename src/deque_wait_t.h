@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * @file  deque_wait_t.h
+ *
+ * @brief Blocking wait type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_WAIT_T_H_INCLUDED
+#define DEQUE_WAIT_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Timeout that never expires
+**/
+#define DEQUE_WAIT_FOREVER    UINT32_MAX
+
+/* Retries of the operation before a waiter goes to sleep */
+#ifndef DEQUE_WAIT_SPINS
+#define DEQUE_WAIT_SPINS      100U
+#endif
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Condition that threads can sleep on until it is notified
+ *
+ * @details Waiters sleep on the epoch word, which every notify bumps. Until
+ *          enabled, notify does nothing at all and waiters poll with short
+ *          naps instead. Once enabled, a notify with nobody waiting costs a
+ *          full fence and a load, but no system call.
+**/
+typedef struct _DequeWait_t
+{
+    _Atomic uint32_t epoch;   /*!< Futex word, bumped by each wakeup */
+    _Atomic uint32_t waiters; /*!< Threads between deciding to sleep and
+                                   waking up */
+    bool             enabled; /*!< Notify wakes sleepers, set before sharing */
+} DequeWait_t;
+
+#endif /* DEQUE_WAIT_T_H_INCLUDED */
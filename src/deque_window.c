@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * @file  deque_window.c
+ *
+ * @brief Sliding window extremum implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_window.h"
+#include "deque.h"
+#include "deque_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Sequence number of an entry
+ ******************************************************************************/
+static uint64_t DequeWindow_Seq(const uint8_t *pEntry)
+{
+    uint64_t seq;
+
+    Deque_CopyElement((uint8_t *)&seq, pEntry, sizeof(seq));
+    return seq;
+}
+
+/*******************************************************************************
+ * @brief  Value of an entry
+ ******************************************************************************/
+static uint8_t *DequeWindow_Value(uint8_t *pEntry)
+{
+    return &pEntry[sizeof(uint64_t)];
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeWindow_Init(DequeWindow_t *pObj, void *pBuf, size_t bufSize,
+                               size_t window, size_t valueSize,
+                               DequeWindow_CmpFn_t pfnCmp)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t entrySize = DEQUE_WINDOW_ENTRY_SIZE(valueSize);
+
+    if ((window == 0) || (valueSize == 0) ||
+        (window > (SIZE_MAX / entrySize)) || (bufSize < (window * entrySize)))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* Exactly window entries, so no entry straddles the buffer end */
+        Deque_Init(&pObj->deque, pBuf, window * entrySize, entrySize);
+        pObj->seq = 0;
+        pObj->window = window;
+        pObj->valueSize = valueSize;
+        pObj->pfnCmp = pfnCmp;
+    }
+
+    return err;
+}
+
+void DequeWindow_Reset(DequeWindow_t *pObj)
+{
+    Deque_Init(&pObj->deque, pObj->deque.pBuf, pObj->deque.bufSize,
+               pObj->deque.dataSize);
+    pObj->seq = 0;
+}
+
+void DequeWindow_Push(DequeWindow_t *pObj, const void *pValueVoid)
+{
+    const uint8_t *pValue = (const uint8_t *)pValueVoid;
+    Deque_Iter_t it;
+    uint8_t *pEntry;
+    size_t dominated = 0;
+    size_t reserved = 0;
+    void *pSlot = NULL;
+
+    /* Entries are in sequence order, so only the front can have slid out of
+     * the window, and at most one per sample */
+    Deque_IterBegin(&pObj->deque, &it);
+    pEntry = Deque_IterNext(&it);
+
+    if ((pEntry != NULL) &&
+        ((pObj->seq - DequeWindow_Seq(pEntry)) >= pObj->window))
+    {
+        Deque_ReleaseFront(&pObj->deque, 1);
+    }
+
+    /* Candidates no better than the new sample can never be the extremum
+     * again: the new sample outlives them. Drop them all in one release */
+    Deque_IterBeginBack(&pObj->deque, &it);
+
+    while (((pEntry = Deque_IterPrev(&it)) != NULL) &&
+           (pObj->pfnCmp(DequeWindow_Value(pEntry), pValue) >= 0))
+    {
+        dominated++;
+    }
+
+    Deque_ReleaseBack(&pObj->deque, dominated);
+
+    /* At most window - 1 entries are left, so there is always room. Build the
+     * entry in place rather than through a staging copy */
+    Deque_ReserveBack(&pObj->deque, 1, &pSlot, &reserved);
+    Deque_CopyElement((uint8_t *)pSlot, (const uint8_t *)&pObj->seq,
+                      sizeof(pObj->seq));
+    Deque_CopyElement(DequeWindow_Value(pSlot), pValue, pObj->valueSize);
+    Deque_CommitBack(&pObj->deque, 1);
+
+    pObj->seq++;
+}
+
+Deque_Error_e DequeWindow_Get(DequeWindow_t *pObj, void *pValueOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    Deque_Iter_t it;
+    uint8_t *pEntry;
+
+    Deque_IterBegin(&pObj->deque, &it);
+    pEntry = Deque_IterNext(&it);
+
+    if (pEntry == NULL)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_CopyElement((uint8_t *)pValueOutVoid, DequeWindow_Value(pEntry),
+                          pObj->valueSize);
+    }
+
+    return err;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file  deque_window.h
+ *
+ * @brief Sliding window extremum public function declarations
+ *
+ * @details Streaming minimum or maximum over the last N samples, using a
+ *          monotonic deque. A new sample evicts every candidate it beats from
+ *          the back and the oldest candidate expires from the front, so each
+ *          sample is pushed and dropped once: amortized O(1) per sample
+ *          instead of a rescan of the window.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_WINDOW_H_INCLUDED
+#define DEQUE_WINDOW_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "deque_window_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the sliding window object
+ *
+ * @details pfnCmp picks what is tracked: an ascending comparison tracks the
+ *          minimum, a descending one the maximum.
+ *
+ * @param pObj       Pointer to the sliding window object
+ * @param pBuf       Pointer to the entry buffer, aligned for a uint64_t
+ * @param bufSize    Size of the buffer, at least DEQUE_WINDOW_BUF_SIZE()
+ * @param window     Number of most recent samples covered, at least 1
+ * @param valueSize  Size of a sample value
+ * @param pfnCmp     Sample ordering, the best value sorting first
+ *
+ * @returns Deque error flag, set if the window or buffer size is invalid
+ ******************************************************************************/
+Deque_Error_e DequeWindow_Init(DequeWindow_t *pObj, void *pBuf, size_t bufSize,
+                               size_t window, size_t valueSize,
+                               DequeWindow_CmpFn_t pfnCmp);
+
+/*******************************************************************************
+ * @brief  Forgets every sample
+ *
+ * @param pObj  Pointer to the sliding window object
+ ******************************************************************************/
+void DequeWindow_Reset(DequeWindow_t *pObj);
+
+/*******************************************************************************
+ * @brief  Adds a sample, sliding the window on by one
+ *
+ * @param pObj         Pointer to the sliding window object
+ * @param pValueVoid   Pointer to the sample value
+ ******************************************************************************/
+void DequeWindow_Push(DequeWindow_t *pObj, const void *pValueVoid);
+
+/*******************************************************************************
+ * @brief  Get the extremum of the samples currently in the window
+ *
+ * @param pObj          Pointer to the sliding window object
+ * @param pValueOutVoid  Receives the extremum
+ *
+ * @returns Deque error flag, set if no sample has been pushed
+ ******************************************************************************/
+Deque_Error_e DequeWindow_Get(DequeWindow_t *pObj, void *pValueOutVoid);
+
+#endif /* DEQUE_WINDOW_H_INCLUDED */
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * @file  deque_window_t.h
+ *
+ * @brief Sliding window extremum type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_WINDOW_T_H_INCLUDED
+#define DEQUE_WINDOW_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief  Size of one entry: the sample's sequence number then its value,
+ *         padded so the next entry stays aligned for a uint64_t
+**/
+#define DEQUE_WINDOW_ENTRY_SIZE(valueSize)                                     \
+    (sizeof(uint64_t) +                                                        \
+     ((((valueSize) + sizeof(uint64_t)) - 1) & ~(sizeof(uint64_t) - 1)))
+
+/**
+ * @brief  Size of the buffer needed by DequeWindow_Init()
+ *
+ * @details Every sample in the window can be a candidate at once, e.g. a
+ *          rising series when tracking the minimum.
+**/
+#define DEQUE_WINDOW_BUF_SIZE(window, valueSize)                               \
+    ((window) * DEQUE_WINDOW_ENTRY_SIZE(valueSize))
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Orders two sample values
+ *
+ * @returns Negative if pA is the better extremum (e.g. smaller, for a
+ *          minimum), 0 if equal, positive otherwise
+**/
+typedef int (*DequeWindow_CmpFn_t)(const void *pA, const void *pB);
+
+/**
+ * @brief  Sliding window extremum object
+ *
+ * @details The deque holds the candidates in a monotonic run: each entry is
+ *          strictly better than every entry behind it, so the front is the
+ *          extremum of the window.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeWindow_t
+{
+    Deque_t  deque;     /*!< Candidate entries, best at the front */
+    uint64_t seq;       /*!< Sequence number of the next sample */
+    uint64_t window;    /*!< Number of most recent samples covered */
+    size_t   valueSize; /*!< Size of a sample value */
+    DequeWindow_CmpFn_t pfnCmp; /*!< Sample ordering */
+} DequeWindow_t;
+
+#endif /* DEQUE_WINDOW_T_H_INCLUDED */
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * @file  deque_ws.c
+ *
+ * @brief Work stealing deque implementation
+ *
+ * @details Follows the C11 formulation of the Chase-Lev deque by Le, Pop,
+ *          Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing
+ *          for Weak Memory Models", with a fixed size buffer.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "deque_ws.h"
+#include "deque_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Signed number of elements between two positions
+ ******************************************************************************/
+static intptr_t DequeWs_Count(size_t back, size_t front)
+{
+    return (intptr_t)(front - back);
+}
+
+/*******************************************************************************
+ * @brief  Pointer to the element slot of a position
+ ******************************************************************************/
+static uint8_t *DequeWs_Slot(DequeWs_t *pObj, size_t pos)
+{
+    return &pObj->pBuf[(pos & pObj->mask) * pObj->dataSize];
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Deque_Error_e DequeWs_Init(DequeWs_t *pObj, void *pBuf, size_t bufSize,
+                           size_t dataSize)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t slots = (dataSize == 0) ? 0 : (bufSize / dataSize);
+
+    if ((slots == 0) || ((bufSize % dataSize) != 0) ||
+        ((slots & (slots - 1)) != 0))
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        atomic_init(&pObj->back, 0);
+        atomic_init(&pObj->front, 0);
+        pObj->pBuf = pBuf;
+        pObj->bufSize = bufSize;
+        pObj->dataSize = dataSize;
+        pObj->mask = slots - 1;
+    }
+
+    return err;
+}
+
+bool DequeWs_IsEmpty(DequeWs_t *pObj)
+{
+    size_t back = atomic_load_explicit(&pObj->back, memory_order_acquire);
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+
+    return (DequeWs_Count(back, front) <= 0);
+}
+
+Deque_Error_e DequeWs_PushFront(DequeWs_t *pObj, void *pDataInVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+    size_t back = atomic_load_explicit(&pObj->back, memory_order_acquire);
+
+    if (DequeWs_Count(back, front) > (intptr_t)pObj->mask)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        Deque_CopyElement(DequeWs_Slot(pObj, front), (uint8_t *)pDataInVoid,
+                          pObj->dataSize);
+
+        /* Publish the element to the thieves */
+        atomic_store_explicit(&pObj->front, front + 1, memory_order_release);
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeWs_PopFront(DequeWs_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_relaxed) - 1;
+    size_t back;
+
+    /* Claim the newest element before looking at what the thieves took */
+    atomic_store_explicit(&pObj->front, front, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    back = atomic_load_explicit(&pObj->back, memory_order_relaxed);
+
+    if (DequeWs_Count(back, front) < 0)
+    {
+        /* Empty, undo the claim */
+        err = Deque_Error;
+        atomic_store_explicit(&pObj->front, front + 1, memory_order_relaxed);
+    }
+    else
+    {
+        Deque_CopyElement((uint8_t *)pDataOutVoid, DequeWs_Slot(pObj, front),
+                          pObj->dataSize);
+
+        if (front == back)
+        {
+            /* Last element, race the thieves for it */
+            if (!atomic_compare_exchange_strong_explicit(&pObj->back, &back,
+                                                         back + 1,
+                                                         memory_order_seq_cst,
+                                                         memory_order_relaxed))
+            {
+                err = Deque_Error;
+            }
+
+            atomic_store_explicit(&pObj->front, front + 1,
+                                  memory_order_relaxed);
+        }
+    }
+
+    return err;
+}
+
+Deque_Error_e DequeWs_StealBack(DequeWs_t *pObj, void *pDataOutVoid)
+{
+    Deque_Error_e err = Deque_Error_None;
+    size_t back = atomic_load_explicit(&pObj->back, memory_order_acquire);
+    size_t front;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+
+    if (DequeWs_Count(back, front) <= 0)
+    {
+        err = Deque_Error;
+    }
+    else
+    {
+        /* The slot can only be reused once back moves past it, in which case
+         * the CAS below fails and the copy is discarded */
+        Deque_CopyElement((uint8_t *)pDataOutVoid, DequeWs_Slot(pObj, back),
+                          pObj->dataSize);
+
+        if (!atomic_compare_exchange_strong_explicit(&pObj->back, &back,
+                                                     back + 1,
+                                                     memory_order_seq_cst,
+                                                     memory_order_relaxed))
+        {
+            err = Deque_Error;
+        }
+    }
+
+    return err;
+}
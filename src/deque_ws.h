@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * @file  deque_ws.h
+ *
+ * @brief Work stealing deque public function declarations
+ *
+ * @details A fixed capacity Chase-Lev deque. One owner thread uses it as a
+ *          stack through DequeWs_PushFront() and DequeWs_PopFront(), which
+ *          only need a read-modify-write when racing a thief for the last
+ *          element. Any other thread may take the oldest element with
+ *          DequeWs_StealBack().
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef DEQUE_WS_H_INCLUDED
+#define DEQUE_WS_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "deque_ws_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the deque object
+ *
+ * @details The caller is responsible for allocating the deque object, and
+ *          deque buffer. Must be called before the deque is shared.
+ *
+ * @param pObj      Pointer to the deque object
+ * @param pBuf      Pointer to the deque buffer
+ * @param bufSize   Size of the buffer, must be a power of two multiple of
+ *                  dataSize
+ * @param dataSize  Size of the data type that the deque is handling
+ *
+ * @returns Deque error flag, set if the buffer does not hold a power of two
+ *          number of elements
+ ******************************************************************************/
+Deque_Error_e DequeWs_Init(DequeWs_t *pObj, void *pBuf, size_t bufSize,
+                           size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the deque is empty
+ *
+ * @details The result is a snapshot, other threads may change it at any time.
+ *
+ * @param pObj  Pointer to the deque object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool DequeWs_IsEmpty(DequeWs_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes data onto the front of the deque
+ *
+ * @details Owner thread only.
+ *
+ * @param pObj         Pointer to the deque object
+ * @param pDataInVoid  Pointer to the data that will be pushed
+ *
+ * @returns Deque error flag, set if the deque is full
+ ******************************************************************************/
+Deque_Error_e DequeWs_PushFront(DequeWs_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops the newest data member off the front of the deque
+ *
+ * @details Owner thread only.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be popped
+ *
+ * @returns Deque error flag, set if the deque is empty or a thief took the
+ *          last element
+ ******************************************************************************/
+Deque_Error_e DequeWs_PopFront(DequeWs_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Steals the oldest data member off the back of the deque
+ *
+ * @details Any thread. A failed steal does not retry, so the caller can move
+ *          on to another victim. pDataOutVoid is only valid on success.
+ *
+ * @param pObj          Pointer to the deque object
+ * @param pDataOutVoid  Pointer to the data that will be stolen
+ *
+ * @returns Deque error flag, set if the deque is empty or another thread
+ *          took the element first
+ ******************************************************************************/
+Deque_Error_e DequeWs_StealBack(DequeWs_t *pObj, void *pDataOutVoid);
+
+#endif /* DEQUE_WS_H_INCLUDED */
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * @file  deque_ws_t.h
+ *
+ * @brief Work stealing deque type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef DEQUE_WS_T_H_INCLUDED
+#define DEQUE_WS_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "deque_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Work stealing deque object
+ *
+ * @details Chase-Lev layout: the owner pushes and pops at the front, thieves
+ *          take from the back. Positions are free running; the elements live
+ *          between back (oldest) and front (newest) at pos & mask.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _DequeWs_t
+{
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t back;     /*!< Position of the oldest element, thieves CAS */
+
+    alignas(DEQUE_CACHE_LINE)
+    atomic_size_t front;    /*!< Position past the newest element, owner only */
+
+    alignas(DEQUE_CACHE_LINE)
+    uint8_t      *pBuf;     /*!< Pointer to the deque buffer */
+    size_t        bufSize;  /*!< Size of the deque buffer */
+    size_t        dataSize; /*!< Size of the data type stored in the deque */
+    size_t        mask;     /*!< Number of slots - 1 */
+} DequeWs_t;
+
+#endif /* DEQUE_WS_T_H_INCLUDED */
@@ -0,0 +1,127 @@
+#ifndef DEQUE_DEFINE_SUITE_INCLUDED
+#define DEQUE_DEFINE_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_define.h"
+
+typedef struct _Sample_t
+{
+    uint64_t timestamp;
+    int16_t  value;
+} Sample_t;
+
+DEQUE_DEFINE(SampleQ, Sample_t, 4)
+DEQUE_DEFINE(ByteQ, uint8_t, 3)
+
+/* Declare a local suite. */
+SUITE(Deque_Define_Suite);
+
+TEST Deque_define_can_report_empty_and_full(void)
+{
+    /*****************    Arrange    *****************/
+    SampleQ q;
+    Sample_t dataIn = { .timestamp = 1, .value = -1 };
+    SampleQ_Init(&q);
+    bool wasEmpty = SampleQ_IsEmpty(&q);
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        SampleQ_PushBack(&q, dataIn);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(true, SampleQ_IsFull(&q));
+    ASSERT_EQ(4U, SampleQ_Count(&q));
+    ASSERT_EQ(Deque_Error, SampleQ_PushFront(&q, dataIn));
+
+    PASS();
+}
+
+TEST Deque_define_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    ByteQ q;
+    uint8_t dataOut;
+    ByteQ_Init(&q);
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = ByteQ_PopFront(&q, &dataOut);
+    Deque_Error_e backErr = ByteQ_PopBack(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error, backErr);
+
+    PASS();
+}
+
+TEST Deque_define_keeps_queue_order_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    ByteQ q;
+    uint8_t dataOut[6] = { 0 };
+    uint8_t expected[6] = { 0, 1, 2, 3, 4, 5 };
+    ByteQ_Init(&q);
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        ByteQ_PushBack(&q, i);
+        ByteQ_PopFront(&q, &dataOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, ByteQ_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_define_can_push_and_pop_at_both_ends(void)
+{
+    /*****************    Arrange    *****************/
+    SampleQ q;
+    Sample_t a = { .timestamp = UINT64_MAX, .value = INT16_MIN };
+    Sample_t b = { .timestamp = 7, .value = INT16_MAX };
+    Sample_t c = { .timestamp = 8, .value = 0 };
+    Sample_t front;
+    Sample_t back;
+    Sample_t peeked;
+    SampleQ_Init(&q);
+
+    /*****************     Act       *****************/
+    SampleQ_PushBack(&q, a);
+    SampleQ_PushFront(&q, b);
+    SampleQ_PushBack(&q, c);
+    SampleQ_PeekBack(&q, &peeked);
+    SampleQ_PopFront(&q, &front);
+    SampleQ_PopBack(&q, &back);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(b.timestamp, front.timestamp);
+    ASSERT_EQ(c.timestamp, back.timestamp);
+    ASSERT_EQ(c.timestamp, peeked.timestamp);
+    ASSERT_EQ(1U, SampleQ_Count(&q));
+    SampleQ_PeekFront(&q, &peeked);
+    ASSERT_EQ(a.timestamp, peeked.timestamp);
+    ASSERT_EQ(a.value, peeked.value);
+
+    PASS();
+}
+
+SUITE(Deque_Define_Suite)
+{
+    RUN_TEST(Deque_define_can_report_empty_and_full);
+    RUN_TEST(Deque_define_pop_fails_if_underflow);
+    RUN_TEST(Deque_define_keeps_queue_order_across_the_buffer_wrap);
+    RUN_TEST(Deque_define_can_push_and_pop_at_both_ends);
+}
+
+#endif /* DEQUE_DEFINE_SUITE_INCLUDED */
@@ -0,0 +1,148 @@
+#ifndef DEQUE_EXEC_SUITE_INCLUDED
+#define DEQUE_EXEC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_exec.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Exec_Suite);
+
+#define EXEC_WORKERS      3U
+#define EXEC_TASKS        64U
+
+typedef struct _Deque_Exec_Fib_t
+{
+    DequeExec_t *pExec;
+    uint32_t     n;
+    uint64_t     result;
+} Deque_Exec_Fib_t;
+
+static DequeExec_t Deque_Exec_Pool;
+static DequeExec_Worker_t Deque_Exec_Workers[EXEC_WORKERS];
+static DequeExec_Task_t Deque_Exec_TaskBuf[(EXEC_WORKERS + 1) * EXEC_TASKS];
+
+static void Deque_Exec_Count(void *pArg)
+{
+    atomic_fetch_add((atomic_uint *)pArg, 1);
+}
+
+static void Deque_Exec_Fib(void *pArg)
+{
+    Deque_Exec_Fib_t *pFib = (Deque_Exec_Fib_t *)pArg;
+
+    if (pFib->n < 2)
+    {
+        pFib->result = pFib->n;
+    }
+    else
+    {
+        Deque_Exec_Fib_t a = { .pExec = pFib->pExec, .n = pFib->n - 1 };
+        Deque_Exec_Fib_t b = { .pExec = pFib->pExec, .n = pFib->n - 2 };
+        DequeExec_Group_t group;
+
+        DequeExec_GroupInit(&group);
+        DequeExec_Spawn(pFib->pExec, &group, Deque_Exec_Fib, &a);
+        Deque_Exec_Fib(&b);
+        DequeExec_Join(pFib->pExec, &group);
+
+        pFib->result = a.result + b.result;
+    }
+}
+
+TEST Deque_exec_init_rejects_non_power_of_two_deques(void)
+{
+    /*****************    Arrange    *****************/
+    DequeExec_t exec;
+    DequeExec_Worker_t workers[1];
+    DequeExec_Task_t tasks[2 * 3];
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeExec_Init(&exec, workers, 1, tasks, 3);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_exec_runs_every_task_fanned_out_from_outside(void)
+{
+    /*****************    Arrange    *****************/
+    DequeExec_Group_t group;
+    atomic_uint count = 0;
+    DequeExec_GroupInit(&group);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        DequeExec_Spawn(&Deque_Exec_Pool, &group, Deque_Exec_Count, &count);
+    }
+    DequeExec_Join(&Deque_Exec_Pool, &group);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1000U, atomic_load(&count));
+
+    PASS();
+}
+
+TEST Deque_exec_can_fork_and_join_from_inside_tasks(void)
+{
+    /*****************    Arrange    *****************/
+    DequeExec_Group_t group;
+    Deque_Exec_Fib_t fib = { .pExec = &Deque_Exec_Pool, .n = 20 };
+    DequeExec_GroupInit(&group);
+
+    /*****************     Act       *****************/
+    DequeExec_Spawn(&Deque_Exec_Pool, &group, Deque_Exec_Fib, &fib);
+    DequeExec_Join(&Deque_Exec_Pool, &group);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(6765U, fib.result);
+
+    PASS();
+}
+
+TEST Deque_exec_wakes_parked_workers(void)
+{
+    /*****************    Arrange    *****************/
+    DequeExec_Group_t group;
+    atomic_uint count = 0;
+    DequeExec_GroupInit(&group);
+
+    /* Give the workers time to run out of work and park */
+    while (atomic_load(&Deque_Exec_Pool.sleepers) < EXEC_WORKERS)
+    {
+        sched_yield();
+    }
+
+    /*****************     Act       *****************/
+    DequeExec_Spawn(&Deque_Exec_Pool, &group, Deque_Exec_Count, &count);
+    DequeExec_Join(&Deque_Exec_Pool, &group);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1U, atomic_load(&count));
+
+    PASS();
+}
+
+SUITE(Deque_Exec_Suite)
+{
+    RUN_TEST(Deque_exec_init_rejects_non_power_of_two_deques);
+
+    DequeExec_Init(&Deque_Exec_Pool, Deque_Exec_Workers, EXEC_WORKERS,
+                   Deque_Exec_TaskBuf, EXEC_TASKS);
+
+    RUN_TEST(Deque_exec_runs_every_task_fanned_out_from_outside);
+    RUN_TEST(Deque_exec_can_fork_and_join_from_inside_tasks);
+    RUN_TEST(Deque_exec_wakes_parked_workers);
+
+    DequeExec_Deinit(&Deque_Exec_Pool);
+}
+
+#endif /* DEQUE_EXEC_SUITE_INCLUDED */
@@ -0,0 +1,121 @@
+#ifndef DEQUE_INSTR_SUITE_INCLUDED
+#define DEQUE_INSTR_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque.h"
+#include "deque_instr.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Instr_Suite);
+
+TEST Deque_instr_reports_exact_small_latencies(void)
+{
+    /*****************    Arrange    *****************/
+    DequeInstr_Report_t report;
+    DequeInstr_Reset();
+    for (uint64_t ns = 1; ns <= 10; ns++)
+    {
+        DequeInstr_Record(Deque_Op_PeekAt, ns);
+    }
+
+    /*****************     Act       *****************/
+    DequeInstr_GetReport(Deque_Op_PeekAt, &report);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(10U, report.count);
+    ASSERT_EQ(5U, report.p50);
+    ASSERT_EQ(10U, report.p99);
+    ASSERT_EQ(10U, report.max);
+
+    PASS();
+}
+
+TEST Deque_instr_percentiles_track_the_tail(void)
+{
+    /*****************    Arrange    *****************/
+    DequeInstr_Report_t report;
+    DequeInstr_Reset();
+    for (uint32_t i = 0; i < 990; i++)
+    {
+        DequeInstr_Record(Deque_Op_PushBack, 100);
+    }
+    for (uint32_t i = 0; i < 9; i++)
+    {
+        DequeInstr_Record(Deque_Op_PushBack, 5000);
+    }
+    DequeInstr_Record(Deque_Op_PushBack, 1000000);
+
+    /*****************     Act       *****************/
+    DequeInstr_GetReport(Deque_Op_PushBack, &report);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1000U, report.count);
+    /* Each percentile is within one bucket width, 1/16, above the sample */
+    ASSERT(report.p50 >= 100 && report.p50 < 107);
+    ASSERT(report.p99 >= 100 && report.p99 < 107);
+    ASSERT(report.p999 >= 5000 && report.p999 < 5313);
+    ASSERT_EQ(1000000U, report.max);
+
+    PASS();
+}
+
+TEST Deque_instr_reset_clears_every_histogram(void)
+{
+    /*****************    Arrange    *****************/
+    DequeInstr_Report_t report;
+    DequeInstr_Record(Deque_Op_PopFront, UINT64_MAX);
+
+    /*****************     Act       *****************/
+    DequeInstr_Reset();
+    DequeInstr_GetReport(Deque_Op_PopFront, &report);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0U, report.count);
+    ASSERT_EQ(0U, report.max);
+    ASSERT_STR_EQ("PopFront", DequeInstr_OpName(Deque_Op_PopFront));
+
+    PASS();
+}
+
+#ifdef DEQUE_INSTRUMENT
+TEST Deque_instr_probes_count_every_call(void)
+{
+    /*****************    Arrange    *****************/
+    DequeInstr_Report_t report;
+    Deque_t q;
+    uint8_t buf[2];
+    uint8_t data = 0;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    DequeInstr_Reset();
+
+    /*****************     Act       *****************/
+    Deque_PushBack(&q, &data);
+    Deque_PushBack(&q, &data);
+    Deque_PushBack(&q, &data);
+
+    /*****************    Assert     *****************/
+    DequeInstr_GetReport(Deque_Op_PushBack, &report);
+    ASSERT_EQ(3U, report.count);
+    DequeInstr_GetReport(Deque_Op_PopBack, &report);
+    ASSERT_EQ(0U, report.count);
+
+    PASS();
+}
+#endif
+
+SUITE(Deque_Instr_Suite)
+{
+    RUN_TEST(Deque_instr_reports_exact_small_latencies);
+    RUN_TEST(Deque_instr_percentiles_track_the_tail);
+    RUN_TEST(Deque_instr_reset_clears_every_histogram);
+#ifdef DEQUE_INSTRUMENT
+    RUN_TEST(Deque_instr_probes_count_every_call);
+#endif
+}
+
+#endif /* DEQUE_INSTR_SUITE_INCLUDED */
@@ -0,0 +1,307 @@
+#ifndef DEQUE_MPMC_SUITE_INCLUDED
+#define DEQUE_MPMC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_mpmc.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Mpmc_Suite);
+
+#define MPMC_PRODUCERS       4U
+#define MPMC_CONSUMERS       2U
+#define MPMC_PER_PRODUCER    20000U
+
+typedef struct _Deque_Mpmc_Worker_t
+{
+    DequeMpmc_t *pQ;
+    uint32_t     id;
+    uint64_t     sum;
+    uint32_t     count;
+} Deque_Mpmc_Worker_t;
+
+static atomic_uint Deque_Mpmc_Consumed;
+
+static void *Deque_Mpmc_Producer(void *pArg)
+{
+    Deque_Mpmc_Worker_t *pWorker = (Deque_Mpmc_Worker_t *)pArg;
+
+    for (uint32_t i = 1; i <= MPMC_PER_PRODUCER; i++)
+    {
+        uint32_t dataIn = (pWorker->id * MPMC_PER_PRODUCER) + i;
+
+        while (DequeMpmc_PushBack(pWorker->pQ, &dataIn) != Deque_Error_None)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void *Deque_Mpmc_Consumer(void *pArg)
+{
+    Deque_Mpmc_Worker_t *pWorker = (Deque_Mpmc_Worker_t *)pArg;
+    uint32_t dataOut;
+    uint32_t total = MPMC_PRODUCERS * MPMC_PER_PRODUCER;
+
+    while (atomic_load(&Deque_Mpmc_Consumed) < total)
+    {
+        if (DequeMpmc_PopFront(pWorker->pQ, &dataOut) == Deque_Error_None)
+        {
+            pWorker->sum += dataOut;
+            pWorker->count++;
+            atomic_fetch_add(&Deque_Mpmc_Consumed, 1);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+TEST Deque_mpmc_init_rejects_non_power_of_two_capacity(void)
+{
+    /*****************    Arrange    *****************/
+    DequeMpmc_t q;
+    uint32_t buf[6];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]),
+                                       seq);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_mpmc_push_fails_when_full_and_pop_fails_when_empty(void)
+{
+    /*****************    Arrange    *****************/
+    DequeMpmc_t q;
+    uint16_t buf[2];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+    uint16_t dataIn = 3;
+    uint16_t dataOut;
+    DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]), seq);
+    Deque_Error_e underErr = DequeMpmc_PopFront(&q, &dataOut);
+
+    /*****************     Act       *****************/
+    DequeMpmc_PushBack(&q, &dataIn);
+    DequeMpmc_PushBack(&q, &dataIn);
+    Deque_Error_e overErr = DequeMpmc_PushBack(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, underErr);
+    ASSERT_EQ(Deque_Error, overErr);
+    ASSERT_EQ(false, DequeMpmc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_mpmc_keeps_queue_order_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    DequeMpmc_t q;
+    uint64_t buf[4];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+    uint64_t dataOut[10] = { 0 };
+    uint64_t expected[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    uint8_t err = (uint8_t)Deque_Error_None;
+    DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]), seq);
+
+    /*****************     Act       *****************/
+    for (uint64_t i = 0; i < ELEMENTS_IN(dataOut); i += 2)
+    {
+        uint64_t next = i + 1;
+
+        err |= DequeMpmc_PushBack(&q, &i);
+        err |= DequeMpmc_PushBack(&q, &next);
+        err |= DequeMpmc_PopFront(&q, &dataOut[i]);
+        err |= DequeMpmc_PopFront(&q, &dataOut[i + 1]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, DequeMpmc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_mpmc_delivers_every_element_exactly_once_between_threads(void)
+{
+    /*****************    Arrange    *****************/
+    static DequeMpmc_t q;
+    uint32_t buf[64];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+    Deque_Mpmc_Worker_t producers[MPMC_PRODUCERS];
+    Deque_Mpmc_Worker_t consumers[MPMC_CONSUMERS];
+    pthread_t threads[MPMC_PRODUCERS + MPMC_CONSUMERS];
+    uint64_t total = MPMC_PRODUCERS * MPMC_PER_PRODUCER;
+    uint64_t expectedSum = (total * (total + 1)) / 2;
+    uint64_t sum = 0;
+    uint32_t count = 0;
+    DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]), seq);
+    atomic_store(&Deque_Mpmc_Consumed, 0);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < MPMC_CONSUMERS; i++)
+    {
+        consumers[i] = (Deque_Mpmc_Worker_t){ .pQ = &q, .id = i };
+        pthread_create(&threads[i], NULL, Deque_Mpmc_Consumer, &consumers[i]);
+    }
+
+    for (uint32_t i = 0; i < MPMC_PRODUCERS; i++)
+    {
+        producers[i] = (Deque_Mpmc_Worker_t){ .pQ = &q, .id = i };
+        pthread_create(&threads[MPMC_CONSUMERS + i], NULL, Deque_Mpmc_Producer,
+                       &producers[i]);
+    }
+
+    for (uint32_t i = 0; i < ELEMENTS_IN(threads); i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (uint32_t i = 0; i < MPMC_CONSUMERS; i++)
+    {
+        sum += consumers[i].sum;
+        count += consumers[i].count;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(total, count);
+    ASSERT_EQ(expectedSum, sum);
+    ASSERT_EQ(true, DequeMpmc_IsEmpty(&q));
+
+    PASS();
+}
+
+static void *Deque_Mpmc_WaitingProducer(void *pArg)
+{
+    Deque_Mpmc_Worker_t *pWorker = (Deque_Mpmc_Worker_t *)pArg;
+
+    for (uint32_t i = 1; i <= MPMC_PER_PRODUCER; i++)
+    {
+        uint32_t dataIn = (pWorker->id * MPMC_PER_PRODUCER) + i;
+
+        DequeMpmc_PushBackWait(pWorker->pQ, &dataIn, DEQUE_WAIT_FOREVER);
+    }
+
+    return NULL;
+}
+
+static void *Deque_Mpmc_WaitingConsumer(void *pArg)
+{
+    Deque_Mpmc_Worker_t *pWorker = (Deque_Mpmc_Worker_t *)pArg;
+    uint32_t dataOut;
+    uint32_t share = (MPMC_PRODUCERS * MPMC_PER_PRODUCER) / MPMC_CONSUMERS;
+
+    for (uint32_t i = 0; i < share; i++)
+    {
+        if (DequeMpmc_PopFrontWait(pWorker->pQ, &dataOut, DEQUE_WAIT_FOREVER)
+            == Deque_Error_None)
+        {
+            pWorker->sum += dataOut;
+            pWorker->count++;
+        }
+    }
+
+    return NULL;
+}
+
+TEST Deque_mpmc_push_wait_times_out_when_nothing_is_popped(void)
+{
+    /*****************    Arrange    *****************/
+    DequeMpmc_t q;
+    uint32_t buf[2];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+    uint32_t dataIn = 7;
+    uint8_t err = (uint8_t)Deque_Error_None;
+    DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]), seq);
+    DequeMpmc_EnableWait(&q);
+    err |= DequeMpmc_PushBack(&q, &dataIn);
+    err |= DequeMpmc_PushBack(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    Deque_Error_e waitErr = DequeMpmc_PushBackWait(&q, &dataIn, 10);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(Deque_Error, waitErr);
+
+    PASS();
+}
+
+TEST Deque_mpmc_wait_calls_deliver_every_element_through_a_tiny_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    static DequeMpmc_t q;
+    uint32_t buf[2];
+    DequeMpmc_Seq_t seq[DEQUE_MPMC_SEQ_COUNT(sizeof(buf), sizeof(buf[0]))];
+    Deque_Mpmc_Worker_t producers[MPMC_PRODUCERS];
+    Deque_Mpmc_Worker_t consumers[MPMC_CONSUMERS];
+    pthread_t threads[MPMC_PRODUCERS + MPMC_CONSUMERS];
+    uint64_t total = MPMC_PRODUCERS * MPMC_PER_PRODUCER;
+    uint64_t expectedSum = (total * (total + 1)) / 2;
+    uint64_t sum = 0;
+    uint32_t count = 0;
+    DequeMpmc_Init(&q, buf, sizeof(buf), sizeof(buf[0]), seq);
+    DequeMpmc_EnableWait(&q);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < MPMC_CONSUMERS; i++)
+    {
+        consumers[i] = (Deque_Mpmc_Worker_t){ .pQ = &q, .id = i };
+        pthread_create(&threads[i], NULL, Deque_Mpmc_WaitingConsumer,
+                       &consumers[i]);
+    }
+
+    for (uint32_t i = 0; i < MPMC_PRODUCERS; i++)
+    {
+        producers[i] = (Deque_Mpmc_Worker_t){ .pQ = &q, .id = i };
+        pthread_create(&threads[MPMC_CONSUMERS + i], NULL,
+                       Deque_Mpmc_WaitingProducer, &producers[i]);
+    }
+
+    for (uint32_t i = 0; i < ELEMENTS_IN(threads); i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (uint32_t i = 0; i < MPMC_CONSUMERS; i++)
+    {
+        sum += consumers[i].sum;
+        count += consumers[i].count;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(total, count);
+    ASSERT_EQ(expectedSum, sum);
+    ASSERT_EQ(true, DequeMpmc_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Deque_Mpmc_Suite)
+{
+    RUN_TEST(Deque_mpmc_init_rejects_non_power_of_two_capacity);
+    RUN_TEST(Deque_mpmc_push_fails_when_full_and_pop_fails_when_empty);
+    RUN_TEST(Deque_mpmc_keeps_queue_order_across_the_buffer_wrap);
+    RUN_TEST(Deque_mpmc_delivers_every_element_exactly_once_between_threads);
+    RUN_TEST(Deque_mpmc_push_wait_times_out_when_nothing_is_popped);
+    RUN_TEST(Deque_mpmc_wait_calls_deliver_every_element_through_a_tiny_buffer);
+}
+
+#endif /* DEQUE_MPMC_SUITE_INCLUDED */
@@ -0,0 +1,267 @@
+#ifndef DEQUE_PERSIST_SUITE_INCLUDED
+#define DEQUE_PERSIST_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_persist.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Persist_Suite);
+
+/* Reserves a fresh, empty file name for a test */
+static void Deque_Persist_TempPath(char *pPath, size_t size)
+{
+    int fd;
+
+    snprintf(pPath, size, "/tmp/deque_persist_XXXXXX");
+    fd = mkstemp(pPath);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+TEST Deque_persist_contents_survive_a_reopen(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    uint32_t dataOut;
+    Deque_Persist_TempPath(path, sizeof(path));
+    ASSERT_EQ(Deque_Error_None,
+              DequePersist_Open(&q, path, 4 * sizeof(uint32_t),
+                                sizeof(uint32_t), DequePersist_Sync_Always, 0));
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        DequePersist_PushBack(&q, &i);
+    }
+    DequePersist_PopFront(&q, &dataOut);
+    uint32_t front = 9;
+    DequePersist_PushFront(&q, &front);
+    DequePersist_Close(&q);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequePersist_Open(&q, path, 4 * sizeof(uint32_t),
+                                          sizeof(uint32_t),
+                                          DequePersist_Sync_Always, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PopFront(&q, &dataOut));
+    ASSERT_EQ(9U, dataOut);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PopBack(&q, &dataOut));
+    ASSERT_EQ(4U, dataOut);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PeekFront(&q, &dataOut));
+    ASSERT_EQ(2U, dataOut);
+
+    DequePersist_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_open_rejects_a_different_layout(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    Deque_Persist_TempPath(path, sizeof(path));
+    DequePersist_Open(&q, path, 64, 4, DequePersist_Sync_Always, 0);
+    DequePersist_Close(&q);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequePersist_Open(&q, path, 64, 8,
+                                          DequePersist_Sync_Always, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_recovers_from_a_torn_cursor_write(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    uint8_t dataIn[] = { 1, 2 };
+    uint8_t dataOut;
+    Deque_Persist_TempPath(path, sizeof(path));
+    DequePersist_Open(&q, path, 8, 1, DequePersist_Sync_Always, 0);
+    DequePersist_PushBack(&q, &dataIn[0]);
+    DequePersist_PushBack(&q, &dataIn[1]);
+    /* Crash half way through writing the newest cursors */
+    q.pHeader->slots[q.seq & 1].rear ^= 0x10;
+    DequePersist_Close(&q);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequePersist_Open(&q, path, 8, 1,
+                                          DequePersist_Sync_Always, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PopFront(&q, &dataOut));
+    ASSERT_EQ(1U, dataOut);
+    ASSERT_EQ(true, DequePersist_IsEmpty(&q));
+
+    DequePersist_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_batches_cursor_publishes(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    uint8_t dataIn = 7;
+    Deque_Persist_TempPath(path, sizeof(path));
+    DequePersist_Open(&q, path, 8, 1, DequePersist_Sync_Batched, 3);
+
+    /*****************     Act       *****************/
+    DequePersist_PushBack(&q, &dataIn);
+    DequePersist_PushBack(&q, &dataIn);
+    uint64_t seqBefore = q.seq;
+    DequePersist_PushBack(&q, &dataIn);
+    uint64_t seqAtBatch = q.seq;
+    DequePersist_PushBack(&q, &dataIn);
+    DequePersist_Flush(&q);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0U, seqBefore);
+    ASSERT_EQ(1U, seqAtBatch);
+    ASSERT_EQ(2U, q.seq);
+    ASSERT_EQ(4U, q.pHeader->slots[0].rear);
+
+    DequePersist_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_push_never_overwrites_data_live_after_a_crash(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    DequePersist_t reopened;
+    char path[64];
+    uint8_t dataIn[] = { 1, 2, 3, 4 };
+    uint8_t late = 99;
+    uint8_t dataOut[3];
+    uint8_t err = (uint8_t)Deque_Error_None;
+    Deque_Persist_TempPath(path, sizeof(path));
+    DequePersist_Open(&q, path, 4, 1, DequePersist_Sync_Batched, 16);
+    for (size_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        DequePersist_PushBack(&q, &dataIn[i]);
+    }
+    DequePersist_Flush(&q);
+
+    /*****************     Act       *****************/
+    DequePersist_PopFront(&q, &dataOut[0]);
+    DequePersist_PushBack(&q, &late);
+    /* Crash: drop the mapping without publishing the batch */
+    munmap(q.pHeader, q.mapSize);
+    close(q.fd);
+    Deque_Error_e openErr = DequePersist_Open(&reopened, path, 4, 1,
+                                              DequePersist_Sync_Batched, 16);
+    for (size_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        err |= DequePersist_PopFront(&reopened, &dataOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, openErr);
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(2U, dataOut[0]);
+    ASSERT_EQ(3U, dataOut[1]);
+    ASSERT_EQ(4U, dataOut[2]);
+    ASSERT_EQ(true, DequePersist_IsEmpty(&reopened));
+
+    DequePersist_Close(&reopened);
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_formats_a_file_left_blank_by_a_crash(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    uint8_t dataIn = 5;
+    uint8_t dataOut = 0;
+    Deque_Persist_TempPath(path, sizeof(path));
+    /* Crash after sizing the new file, before its header was synced */
+    ASSERT_EQ(0, truncate(path, DEQUE_PERSIST_HEADER_SIZE + 64));
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequePersist_Open(&q, path, 64, 1,
+                                          DequePersist_Sync_Always, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(true, DequePersist_IsEmpty(&q));
+    ASSERT_EQ(Deque_Error_None, DequePersist_PushBack(&q, &dataIn));
+    DequePersist_Close(&q);
+    ASSERT_EQ(Deque_Error_None, DequePersist_Open(&q, path, 64, 1,
+                                                  DequePersist_Sync_Always,
+                                                  0));
+    ASSERT_EQ(Deque_Error_None, DequePersist_PopFront(&q, &dataOut));
+    ASSERT_EQ(5U, dataOut);
+
+    DequePersist_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Deque_persist_undoes_operations_whose_sync_fails(void)
+{
+    /*****************    Arrange    *****************/
+    DequePersist_t q;
+    char path[64];
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uint8_t dataIn[] = { 1, 2 };
+    uint8_t dataOut = 0;
+    Deque_Persist_TempPath(path, sizeof(path));
+    DequePersist_Open(&q, path, 2 * page, 1, DequePersist_Sync_Batched, 2);
+    DequePersist_PushBack(&q, &dataIn[0]);
+    /* Pull the last data page out from under the mapping, so the flush at
+     * the end of the batch fails to sync it */
+    munmap((uint8_t *)q.pHeader + DEQUE_PERSIST_HEADER_SIZE + page, page);
+
+    /*****************     Act       *****************/
+    Deque_Error_e pushErr = DequePersist_PushBack(&q, &dataIn[1]);
+    Deque_Error_e popErr = DequePersist_PopFront(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, pushErr);
+    ASSERT_EQ(Deque_Error, popErr);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PeekBack(&q, &dataOut));
+    ASSERT_EQ(1U, dataOut);
+    ASSERT_EQ(Deque_Error_None, DequePersist_PeekFront(&q, &dataOut));
+    ASSERT_EQ(1U, dataOut);
+    ASSERT_EQ(1U, q.pending);
+    ASSERT_EQ(0U, q.seq);
+
+    DequePersist_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+SUITE(Deque_Persist_Suite)
+{
+    RUN_TEST(Deque_persist_contents_survive_a_reopen);
+    RUN_TEST(Deque_persist_open_rejects_a_different_layout);
+    RUN_TEST(Deque_persist_recovers_from_a_torn_cursor_write);
+    RUN_TEST(Deque_persist_batches_cursor_publishes);
+    RUN_TEST(Deque_persist_push_never_overwrites_data_live_after_a_crash);
+    RUN_TEST(Deque_persist_formats_a_file_left_blank_by_a_crash);
+    RUN_TEST(Deque_persist_undoes_operations_whose_sync_fails);
+}
+
+#endif /* DEQUE_PERSIST_SUITE_INCLUDED */
@@ -0,0 +1,226 @@
+#ifndef DEQUE_POOL_SUITE_INCLUDED
+#define DEQUE_POOL_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque.h"
+#include "deque_seg.h"
+#include "deque_pool.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Pool_Suite);
+
+static void *Deque_Pool_FreeOnThread(void *pArg)
+{
+    DequePool_t *pPool = (DequePool_t *)pArg;
+
+    DequePool_Free(pPool, DequePool_Alloc(pPool));
+    DequePool_FlushThreadCache(pPool);
+
+    return NULL;
+}
+
+static void *Deque_Pool_ExitHoldingCache(void *pArg)
+{
+    DequePool_t *pPool = (DequePool_t *)pArg;
+    void *pBlocks[3];
+
+    for (size_t i = 0; i < ELEMENTS_IN(pBlocks); i++)
+    {
+        pBlocks[i] = DequePool_Alloc(pPool);
+    }
+    for (size_t i = 0; i < ELEMENTS_IN(pBlocks); i++)
+    {
+        DequePool_Free(pPool, pBlocks[i]);
+    }
+
+    /* Exit without DequePool_FlushThreadCache() */
+    return NULL;
+}
+
+TEST Deque_pool_reuses_freed_blocks(void)
+{
+    /*****************    Arrange    *****************/
+    DequePool_t pool;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t backing =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    DequePool_Init(&pool, &backing, 64, 8);
+
+    /*****************     Act       *****************/
+    void *pFirst = DequePool_Alloc(&pool);
+    DequePool_Free(&pool, pFirst);
+    void *pSecond = DequePool_Alloc(&pool);
+    DequePool_Free(&pool, pSecond);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(pFirst, pSecond);
+    ASSERT_EQ(1U, stats.allocs);
+
+    DequePool_Deinit(&pool);
+    ASSERT_EQ(0U, stats.live);
+    PASS();
+}
+
+TEST Deque_pool_passes_other_sizes_to_the_backing_hooks(void)
+{
+    /*****************    Arrange    *****************/
+    DequePool_t pool;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t backing =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    DequePool_Init(&pool, &backing, 4, 8);
+    const Deque_Allocator_t *pAlloc = DequePool_Allocator(&pool);
+
+    /*****************     Act       *****************/
+    void *pOther = pAlloc->pfnAlloc(pAlloc->pCtx, 100);
+    size_t liveWhileHeld = stats.live;
+    pAlloc->pfnFree(pAlloc->pCtx, pOther, 100);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(100U, liveWhileHeld);
+    ASSERT_EQ(0U, stats.live);
+
+    DequePool_Deinit(&pool);
+    PASS();
+}
+
+TEST Deque_pool_recycles_buffers_of_short_lived_deques(void)
+{
+    /*****************    Arrange    *****************/
+    DequePool_t pool;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t backing =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    /* Same size as a new segmented chunk map, so that is pooled too */
+    const size_t blockSize = DEQUE_SEG_MAP_MIN * sizeof(uint8_t *);
+    const uint32_t perBlock = blockSize / sizeof(uint32_t);
+    DequePool_Init(&pool, &backing, blockSize, 8);
+
+    /*****************     Act       *****************/
+    for (uint32_t round = 0; round < 100; round++)
+    {
+        Deque_t q;
+        DequeSeg_t seg;
+        uint32_t dataOut;
+
+        Deque_InitDynamic(&q, DequePool_Allocator(&pool), perBlock,
+                          sizeof(uint32_t));
+        DequeSeg_Init(&seg, DequePool_Allocator(&pool), perBlock,
+                      sizeof(uint32_t));
+        for (uint32_t i = 0; i < 3 * perBlock; i++)
+        {
+            /* Stay within the pooled size, a grown buffer is not pooled */
+            if (i < perBlock)
+            {
+                Deque_PushBack(&q, &i);
+            }
+            DequeSeg_PushBack(&seg, &i);
+        }
+        Deque_PopFront(&q, &dataOut);
+        ASSERT_EQ(0U, dataOut);
+        Deque_Deinit(&q);
+        DequeSeg_Deinit(&seg);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(5U, stats.allocs);
+
+    DequePool_Deinit(&pool);
+    ASSERT_EQ(0U, stats.live);
+    PASS();
+}
+
+TEST Deque_pool_shares_flushed_blocks_between_threads(void)
+{
+    /*****************    Arrange    *****************/
+    DequePool_t pool;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t backing =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    pthread_t thread;
+    DequePool_Init(&pool, &backing, 32, 8);
+
+    /*****************     Act       *****************/
+    pthread_create(&thread, NULL, Deque_Pool_FreeOnThread, &pool);
+    pthread_join(thread, NULL);
+    void *pBlock = DequePool_Alloc(&pool);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1U, stats.allocs);
+    ASSERT_EQ(0U, pool.freeCount);
+
+    DequePool_Free(&pool, pBlock);
+    DequePool_Deinit(&pool);
+    ASSERT_EQ(0U, stats.live);
+    PASS();
+}
+
+TEST Deque_pool_flushes_the_cache_of_an_exiting_thread(void)
+{
+    /*****************    Arrange    *****************/
+    DequePool_t pool;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t backing =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    pthread_t thread;
+    void *pBlocks[3];
+    DequePool_Init(&pool, &backing, 64, 8);
+
+    /*****************     Act       *****************/
+    pthread_create(&thread, NULL, Deque_Pool_ExitHoldingCache, &pool);
+    pthread_join(thread, NULL);
+    size_t freeAfterExit = pool.freeCount;
+    for (size_t i = 0; i < ELEMENTS_IN(pBlocks); i++)
+    {
+        pBlocks[i] = DequePool_Alloc(&pool);
+    }
+    for (size_t i = 0; i < ELEMENTS_IN(pBlocks); i++)
+    {
+        DequePool_Free(&pool, pBlocks[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3U, freeAfterExit);
+    ASSERT_EQ(3U, stats.allocs);
+
+    DequePool_Deinit(&pool);
+    ASSERT_EQ(0U, stats.live);
+    PASS();
+}
+
+SUITE(Deque_Pool_Suite)
+{
+    RUN_TEST(Deque_pool_reuses_freed_blocks);
+    RUN_TEST(Deque_pool_passes_other_sizes_to_the_backing_hooks);
+    RUN_TEST(Deque_pool_recycles_buffers_of_short_lived_deques);
+    RUN_TEST(Deque_pool_shares_flushed_blocks_between_threads);
+    RUN_TEST(Deque_pool_flushes_the_cache_of_an_exiting_thread);
+}
+
+#endif /* DEQUE_POOL_SUITE_INCLUDED */
@@ -0,0 +1,112 @@
+#ifndef DEQUE_PRIO_SUITE_INCLUDED
+#define DEQUE_PRIO_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque.h"
+#include "deque_prio.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Prio_Suite);
+
+TEST Deque_prio_init_rejects_bad_lane_counts(void)
+{
+    /*****************    Arrange    *****************/
+    DequePrio_t q;
+    Deque_t lanes[DEQUE_PRIO_LANES_MAX + 1];
+
+    /*****************     Act       *****************/
+    Deque_Error_e noneErr = DequePrio_Init(&q, lanes, 0);
+    Deque_Error_e tooManyErr = DequePrio_Init(&q, lanes, ELEMENTS_IN(lanes));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, noneErr);
+    ASSERT_EQ(Deque_Error, tooManyErr);
+
+    PASS();
+}
+
+TEST Deque_prio_pops_the_most_urgent_lane_first(void)
+{
+    /*****************    Arrange    *****************/
+    DequePrio_t q;
+    Deque_t lanes[3];
+    uint8_t bufs[3][4];
+    uint8_t dataIn[] = { 10, 11, 20, 30, 31 };
+    uint32_t prioIn[] = { 0, 0, 1, 2, 2 };
+    uint8_t dataOut[5];
+    uint32_t prioOut[5];
+    uint8_t err = (uint8_t)Deque_Error_None;
+    for (uint32_t i = 0; i < ELEMENTS_IN(lanes); i++)
+    {
+        Deque_Init(&lanes[i], bufs[i], sizeof(bufs[i]), sizeof(uint8_t));
+    }
+    DequePrio_Init(&q, lanes, ELEMENTS_IN(lanes));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        err |= DequePrio_PushBack(&q, prioIn[i], &dataIn[i]);
+    }
+    for (uint32_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        err |= DequePrio_PopFront(&q, &dataOut[i], &prioOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(30U, dataOut[0]);
+    ASSERT_EQ(31U, dataOut[1]);
+    ASSERT_EQ(20U, dataOut[2]);
+    ASSERT_EQ(10U, dataOut[3]);
+    ASSERT_EQ(11U, dataOut[4]);
+    ASSERT_EQ(2U, prioOut[0]);
+    ASSERT_EQ(0U, prioOut[4]);
+    ASSERT_EQ(true, DequePrio_IsEmpty(&q));
+    ASSERT_EQ(Deque_Error, DequePrio_PopFront(&q, &dataOut[0], NULL));
+
+    PASS();
+}
+
+TEST Deque_prio_push_fails_on_a_full_or_missing_lane(void)
+{
+    /*****************    Arrange    *****************/
+    DequePrio_t q;
+    Deque_t lanes[2];
+    uint8_t bufs[2][1];
+    uint8_t dataIn = 1;
+    uint8_t dataOut;
+    uint32_t prioOut;
+    Deque_Init(&lanes[0], bufs[0], sizeof(bufs[0]), sizeof(uint8_t));
+    Deque_Init(&lanes[1], bufs[1], sizeof(bufs[1]), sizeof(uint8_t));
+    DequePrio_Init(&q, lanes, ELEMENTS_IN(lanes));
+
+    /*****************     Act       *****************/
+    Deque_Error_e firstErr = DequePrio_PushBack(&q, 0, &dataIn);
+    Deque_Error_e fullErr = DequePrio_PushFront(&q, 0, &dataIn);
+    Deque_Error_e rangeErr = DequePrio_PushBack(&q, 2, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, firstErr);
+    ASSERT_EQ(Deque_Error, fullErr);
+    ASSERT_EQ(Deque_Error, rangeErr);
+    ASSERT_EQ(Deque_Error_None, DequePrio_PeekFront(&q, &dataOut, &prioOut));
+    ASSERT_EQ(1U, dataOut);
+    ASSERT_EQ(0U, prioOut);
+    ASSERT_EQ(false, DequePrio_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Deque_Prio_Suite)
+{
+    RUN_TEST(Deque_prio_init_rejects_bad_lane_counts);
+    RUN_TEST(Deque_prio_pops_the_most_urgent_lane_first);
+    RUN_TEST(Deque_prio_push_fails_on_a_full_or_missing_lane);
+}
+
+#endif /* DEQUE_PRIO_SUITE_INCLUDED */
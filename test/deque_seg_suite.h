@@ -0,0 +1,160 @@
+#ifndef DEQUE_SEG_SUITE_INCLUDED
+#define DEQUE_SEG_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque.h"
+#include "deque_seg.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Seg_Suite);
+
+TEST Deque_seg_init_rejects_empty_chunks(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSeg_t q;
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeSeg_Init(&q, &Deque_StdAllocator, 0,
+                                      sizeof(uint32_t));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_seg_pop_fails_if_empty(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSeg_t q;
+    uint32_t dataOut;
+    DequeSeg_Init(&q, &Deque_StdAllocator, 4, sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = DequeSeg_PopFront(&q, &dataOut);
+    Deque_Error_e backErr = DequeSeg_PopBack(&q, &dataOut);
+    Deque_Error_e peekErr = DequeSeg_PeekFront(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(Deque_Error, peekErr);
+    ASSERT_EQ(true, DequeSeg_IsEmpty(&q));
+
+    DequeSeg_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_seg_grows_at_both_ends_across_many_chunks(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSeg_t q;
+    const uint32_t half = 200;
+    uint32_t dataOut;
+    DequeSeg_Init(&q, &Deque_StdAllocator, 3, sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < half; i++)
+    {
+        uint32_t back = half + i;
+        uint32_t front = half - 1 - i;
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PushBack(&q, &back));
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PushFront(&q, &front));
+    }
+
+    /*****************    Assert     *****************/
+    for (uint32_t i = 0; i < 2 * half; i++)
+    {
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PeekAt(&q, i, &dataOut));
+        ASSERT_EQ(i, dataOut);
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PeekAtBack(&q, i, &dataOut));
+        ASSERT_EQ(2 * half - 1 - i, dataOut);
+    }
+    ASSERT_EQ(Deque_Error, DequeSeg_PeekAt(&q, 2 * half, &dataOut));
+    for (uint32_t i = 0; i < half; i++)
+    {
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PopFront(&q, &dataOut));
+        ASSERT_EQ(i, dataOut);
+        ASSERT_EQ(Deque_Error_None, DequeSeg_PopBack(&q, &dataOut));
+        ASSERT_EQ(2 * half - 1 - i, dataOut);
+    }
+    ASSERT_EQ(true, DequeSeg_IsEmpty(&q));
+
+    DequeSeg_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_seg_does_not_move_elements_when_growing(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSeg_t q;
+    uint8_t dataIn = 7;
+    uint8_t dataOut;
+    DequeSeg_Init(&q, &Deque_StdAllocator, 2, sizeof(uint8_t));
+    DequeSeg_PushBack(&q, &dataIn);
+    uint8_t *pFirst = &q.ppMap[q.mapFront][q.frontOff];
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        DequeSeg_PushBack(&q, &i);
+        DequeSeg_PushFront(&q, &i);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, DequeSeg_PeekAt(&q, 100, &dataOut));
+    ASSERT_EQ(7U, dataOut);
+    ASSERT_EQ(7U, *pFirst);
+    ASSERT(q.mapSize > DEQUE_SEG_MAP_MIN);
+
+    DequeSeg_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_seg_can_be_used_as_a_queue_and_refilled(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSeg_t q;
+    uint16_t dataOut = 0;
+    uint16_t expected = 0;
+    uint16_t next = 0;
+    DequeSeg_Init(&q, &Deque_StdAllocator, 4, sizeof(uint16_t));
+
+    /*****************     Act       *****************/
+    for (uint16_t round = 0; round < 50; round++)
+    {
+        for (uint16_t i = 0; i < 7; i++, next++)
+        {
+            DequeSeg_PushBack(&q, &next);
+        }
+        for (uint16_t i = 0; i < 5; i++, expected++)
+        {
+            ASSERT_EQ(Deque_Error_None, DequeSeg_PopFront(&q, &dataOut));
+            ASSERT_EQ(expected, dataOut);
+        }
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, DequeSeg_PeekBack(&q, &dataOut));
+    ASSERT_EQ(next - 1, dataOut);
+    ASSERT_EQ(100U, q.count);
+
+    DequeSeg_Deinit(&q);
+    PASS();
+}
+
+SUITE(Deque_Seg_Suite)
+{
+    RUN_TEST(Deque_seg_init_rejects_empty_chunks);
+    RUN_TEST(Deque_seg_pop_fails_if_empty);
+    RUN_TEST(Deque_seg_grows_at_both_ends_across_many_chunks);
+    RUN_TEST(Deque_seg_does_not_move_elements_when_growing);
+    RUN_TEST(Deque_seg_can_be_used_as_a_queue_and_refilled);
+}
+
+#endif /* DEQUE_SEG_SUITE_INCLUDED */
@@ -0,0 +1,229 @@
+#ifndef DEQUE_SPSC_SUITE_INCLUDED
+#define DEQUE_SPSC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_spsc.h"
+#include "deque_instr.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Spsc_Suite);
+
+#define SPSC_STRESS_COUNT    100000U
+
+static void *Deque_Spsc_Producer(void *pArg)
+{
+    DequeSpsc_t *pQ = (DequeSpsc_t *)pArg;
+
+    for (uint32_t i = 0; i < SPSC_STRESS_COUNT; i++)
+    {
+        while (DequeSpsc_PushBack(pQ, &i) != Deque_Error_None)
+        {
+            /* Wait for the consumer to make room */
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void *Deque_Spsc_WaitingProducer(void *pArg)
+{
+    DequeSpsc_t *pQ = (DequeSpsc_t *)pArg;
+
+    for (uint32_t i = 0; i < SPSC_STRESS_COUNT; i++)
+    {
+        DequeSpsc_PushBackWait(pQ, &i, DEQUE_WAIT_FOREVER);
+    }
+
+    return NULL;
+}
+
+TEST Deque_spsc_init_rejects_partial_elements(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSpsc_t q;
+    uint8_t buf[10];
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeSpsc_Init(&q, buf, sizeof(buf), 4);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_spsc_can_report_empty_and_full(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSpsc_t q;
+    uint16_t buf[2];
+    uint16_t dataIn = 7;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    bool wasEmpty = DequeSpsc_IsEmpty(&q);
+
+    /*****************     Act       *****************/
+    DequeSpsc_PushBack(&q, &dataIn);
+    DequeSpsc_PushBack(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(true, DequeSpsc_IsFull(&q));
+    ASSERT_EQ(Deque_Error, DequeSpsc_PushBack(&q, &dataIn));
+
+    PASS();
+}
+
+TEST Deque_spsc_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSpsc_t q;
+    uint16_t buf[2];
+    uint16_t dataOut;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e peekErr = DequeSpsc_PeekFront(&q, &dataOut);
+    Deque_Error_e popErr = DequeSpsc_PopFront(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, peekErr);
+    ASSERT_EQ(Deque_Error, popErr);
+
+    PASS();
+}
+
+TEST Deque_spsc_keeps_queue_order_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSpsc_t q;
+    uint32_t buf[3];
+    uint32_t dataOut[7] = { 0 };
+    uint32_t expected[7] = { 0, 1, 2, 3, 4, 5, 6 };
+    uint32_t peeked = 0;
+    uint8_t err = (uint8_t)Deque_Error_None;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        err |= DequeSpsc_PushBack(&q, &i);
+        err |= DequeSpsc_PeekFront(&q, &peeked);
+        err |= DequeSpsc_PopFront(&q, &dataOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(6U, peeked);
+    ASSERT_EQ(true, DequeSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_spsc_delivers_every_element_in_order_between_threads(void)
+{
+    /*****************    Arrange    *****************/
+    static DequeSpsc_t q;
+    uint32_t buf[64];
+    uint32_t dataOut;
+    uint32_t expected = 0;
+    uint32_t outOfOrder = 0;
+    pthread_t producer;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    pthread_create(&producer, NULL, Deque_Spsc_Producer, &q);
+
+    while (expected < SPSC_STRESS_COUNT)
+    {
+        if (DequeSpsc_PopFront(&q, &dataOut) == Deque_Error_None)
+        {
+            outOfOrder += (dataOut != expected);
+            expected++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    pthread_join(producer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0U, outOfOrder);
+    ASSERT_EQ(true, DequeSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_spsc_pop_wait_times_out_when_nothing_is_pushed(void)
+{
+    /*****************    Arrange    *****************/
+    DequeSpsc_t q;
+    uint32_t buf[4];
+    uint32_t dataOut;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    uint64_t start = DequeInstr_Now();
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeSpsc_PopFrontWait(&q, &dataOut, 10);
+    uint64_t elapsed = DequeInstr_Now() - start;
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+    ASSERT(elapsed >= 9000000U);
+
+    PASS();
+}
+
+TEST Deque_spsc_wait_calls_deliver_every_element_through_a_tiny_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    static DequeSpsc_t q;
+    uint32_t buf[2];
+    uint32_t dataOut;
+    uint32_t outOfOrder = 0;
+    uint8_t err = (uint8_t)Deque_Error_None;
+    pthread_t producer;
+    DequeSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    DequeSpsc_EnableWait(&q);
+
+    /*****************     Act       *****************/
+    pthread_create(&producer, NULL, Deque_Spsc_WaitingProducer, &q);
+
+    for (uint32_t expected = 0; expected < SPSC_STRESS_COUNT; expected++)
+    {
+        err |= DequeSpsc_PopFrontWait(&q, &dataOut, DEQUE_WAIT_FOREVER);
+        outOfOrder += (dataOut != expected);
+    }
+
+    pthread_join(producer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(0U, outOfOrder);
+    ASSERT_EQ(true, DequeSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Deque_Spsc_Suite)
+{
+    RUN_TEST(Deque_spsc_init_rejects_partial_elements);
+    RUN_TEST(Deque_spsc_can_report_empty_and_full);
+    RUN_TEST(Deque_spsc_pop_fails_if_underflow);
+    RUN_TEST(Deque_spsc_keeps_queue_order_across_the_buffer_wrap);
+    RUN_TEST(Deque_spsc_delivers_every_element_in_order_between_threads);
+    RUN_TEST(Deque_spsc_pop_wait_times_out_when_nothing_is_pushed);
+    RUN_TEST(Deque_spsc_wait_calls_deliver_every_element_through_a_tiny_buffer);
+}
+
+#endif /* DEQUE_SPSC_SUITE_INCLUDED */
@@ -278,6 +278,27 @@ TEST Deque_can_front_pop_2_byte_data_types_when_pushed_from_back(void)
     PASS();
 }
 
+TEST Deque_can_front_pop_4_byte_data_types_when_pushed_from_back(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t buf[4];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    uint32_t dataIn = 0xDEADBEEF;
+    uint32_t dataOut;
+
+    Deque_PushBack(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PopFront(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(dataIn, dataOut);
+
+    PASS();
+}
+
 TEST Deque_can_front_pop_8_byte_data_types_when_pushed_from_back(void)
 {
     /*****************    Arrange    *****************/
@@ -1274,6 +1295,1045 @@ TEST Deque_can_partially_fill_and_empty_multiple_times()
     PASS();
 }
 
+TEST Deque_can_push_back_n_and_pop_front_n_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t buf[5];
+    uint32_t dataIn[] = { 0xDEADBEEF, 1, 2, 3 };
+    uint32_t dataOut[4] = { 0 };
+    uint32_t scratch[3];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /* Move the cursors near the end of the buffer */
+    Deque_PushBackN(&q, scratch, ELEMENTS_IN(scratch));
+    Deque_PopFrontN(&q, scratch, ELEMENTS_IN(scratch));
+
+    /*****************     Act       *****************/
+    Deque_Error_e pushErr = Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_Error_e popErr = Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, pushErr);
+    ASSERT_EQ(Deque_Error_None, popErr);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_can_push_front_n_and_pop_back_n_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[6];
+    uint16_t dataIn[] = { 10, 20, 30, 40, 50, 60 };
+    uint16_t dataOut[6] = { 0 };
+    uint16_t front;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e pushErr = Deque_PushFrontN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_PeekFront(&q, &front);
+    Deque_Error_e popErr = Deque_PopBackN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, pushErr);
+    ASSERT_EQ(Deque_Error_None, popErr);
+    ASSERT_EQ(dataIn[0], front);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_bulk_push_keeps_element_order_for_single_pops(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3 };
+    uint8_t first;
+    uint8_t last;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_PopFront(&q, &first);
+    Deque_PopBack(&q, &last);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(dataIn[0], first);
+    ASSERT_EQ(dataIn[2], last);
+
+    PASS();
+}
+
+TEST Deque_bulk_push_fails_without_room_for_every_element(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3 };
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBack(&q, &dataIn[0]);
+    Deque_PushBack(&q, &dataIn[0]);
+
+    /*****************     Act       *****************/
+    Deque_Error_e backErr = Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_Error_e frontErr = Deque_PushFrontN(&q, dataIn, SIZE_MAX);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error_None, Deque_PushBackN(&q, dataIn, 2));
+    ASSERT_EQ(true, Deque_IsFull(&q));
+
+    PASS();
+}
+
+TEST Deque_bulk_pop_fails_without_enough_elements(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2 };
+    uint8_t dataOut[3];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+    Deque_Error_e backErr = Deque_PopBackN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(false, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_power_of_two_init_rejects_other_buffer_sizes(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[24];
+
+    /*****************     Act       *****************/
+    Deque_Error_e oddErr = Deque_InitPow2(&q, buf, sizeof(buf), 1);
+    Deque_Error_e zeroErr = Deque_InitPow2(&q, buf, 0, 1);
+    Deque_Error_e sizeErr = Deque_InitPow2(&q, buf, 16, 3);
+    Deque_Error_e okErr = Deque_InitPow2(&q, buf, 16, 4);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, oddErr);
+    ASSERT_EQ(Deque_Error, zeroErr);
+    ASSERT_EQ(Deque_Error, sizeErr);
+    ASSERT_EQ(Deque_Error_None, okErr);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_power_of_two_buffer_wraps_at_both_ends(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint16_t dataOut[8] = { 0 };
+    uint16_t expected[] = { 2, 1, 4, 3, 6, 5, 8, 7 };
+    uint8_t err = (uint8_t)Deque_Error_None;
+    Deque_InitPow2(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataIn); i += 2)
+    {
+        err |= Deque_PushBack(&q, &dataIn[i]);
+        err |= Deque_PushFront(&q, &dataIn[i + 1]);
+        err |= Deque_PopFront(&q, &dataOut[i]);
+        err |= Deque_PopBack(&q, &dataOut[i + 1]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_can_reserve_and_commit_at_the_back(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t buf[4];
+    uint32_t *pSlot;
+    size_t count;
+    uint32_t dataOut[3];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_ReserveBack(&q, 3, (void **)&pSlot, &count);
+    pSlot[0] = 10;
+    pSlot[1] = 20;
+    pSlot[2] = 30;
+    Deque_Error_e commitErr = Deque_CommitBack(&q, count);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(Deque_Error_None, commitErr);
+    ASSERT_EQ(3U, count);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFrontN(&q, dataOut, 3));
+    ASSERT_EQ(10U, dataOut[0]);
+    ASSERT_EQ(30U, dataOut[2]);
+
+    PASS();
+}
+
+TEST Deque_back_reservation_stops_at_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3 };
+    uint8_t dataOut[2];
+    uint8_t *pSlot;
+    size_t count;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************     Act       *****************/
+    Deque_ReserveBack(&q, 3, (void **)&pSlot, &count);
+    Deque_Error_e overErr = Deque_CommitBack(&q, count + 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1U, count);
+    ASSERT_EQ(&buf[3], pSlot);
+    ASSERT_EQ(Deque_Error, overErr);
+
+    PASS();
+}
+
+TEST Deque_reserve_fails_when_full(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[2];
+    uint8_t dataIn[] = { 1, 2 };
+    void *pSlot;
+    size_t count = 1;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e backErr = Deque_ReserveBack(&q, 1, &pSlot, &count);
+    Deque_Error_e frontErr = Deque_ReserveFront(&q, 1, &pSlot, &count);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(0U, count);
+
+    PASS();
+}
+
+TEST Deque_can_reserve_and_commit_at_the_front(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn = 99;
+    uint16_t *pSlot;
+    size_t count;
+    uint16_t dataOut[3];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBack(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    Deque_ReserveFront(&q, 3, (void **)&pSlot, &count);
+    pSlot[count - 2] = 1;
+    pSlot[count - 1] = 2;
+    Deque_Error_e err = Deque_CommitFront(&q, 2);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFrontN(&q, dataOut, 3));
+    ASSERT_EQ(1U, dataOut[0]);
+    ASSERT_EQ(2U, dataOut[1]);
+    ASSERT_EQ(99U, dataOut[2]);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_front_spans_split_at_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[2];
+    Deque_Span_t spans[2];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 2);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PeekFrontSpans(&q, spans);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(&buf[2], spans[0].pData);
+    ASSERT_EQ(2U, spans[0].count);
+    ASSERT_EQ(&buf[0], spans[1].pData);
+    ASSERT_EQ(1U, spans[1].count);
+    ASSERT_EQ(3U, ((uint16_t *)spans[0].pData)[0]);
+    ASSERT_EQ(2U, ((uint16_t *)spans[1].pData)[0]);
+
+    PASS();
+}
+
+TEST Deque_back_spans_start_with_the_run_ending_at_the_rear(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[2];
+    Deque_Span_t spans[2];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 2);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PeekBackSpans(&q, spans);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(&buf[0], spans[0].pData);
+    ASSERT_EQ(1U, spans[0].count);
+    ASSERT_EQ(&buf[2], spans[1].pData);
+    ASSERT_EQ(2U, spans[1].count);
+
+    PASS();
+}
+
+TEST Deque_spans_are_empty_when_the_deque_is_empty(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    Deque_Span_t spans[2];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PeekFrontSpans(&q, spans);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+    ASSERT_EQ(NULL, spans[0].pData);
+    ASSERT_EQ(0U, spans[0].count);
+    ASSERT_EQ(NULL, spans[1].pData);
+    ASSERT_EQ(0U, spans[1].count);
+
+    PASS();
+}
+
+TEST Deque_can_release_data_from_both_ends(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3, 4 };
+    uint8_t dataOut;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = Deque_ReleaseFront(&q, 1);
+    Deque_Error_e backErr = Deque_ReleaseBack(&q, 2);
+    Deque_Error_e overErr = Deque_ReleaseFront(&q, 2);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, frontErr);
+    ASSERT_EQ(Deque_Error_None, backErr);
+    ASSERT_EQ(Deque_Error, overErr);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFront(&q, &dataOut));
+    ASSERT_EQ(2U, dataOut);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_iterator_walks_front_to_back_in_place_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Iter_t it;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[2];
+    uint16_t *pSeen[5];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 3);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_IterBegin(&q, &it);
+    for (size_t i = 0; i < ELEMENTS_IN(pSeen); i++)
+    {
+        pSeen[i] = Deque_IterNext(&it);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(&buf[2], pSeen[0]);
+    ASSERT_EQ(&buf[3], pSeen[1]);
+    ASSERT_EQ(&buf[0], pSeen[2]);
+    ASSERT_EQ(&buf[1], pSeen[3]);
+    ASSERT_EQ(NULL, pSeen[4]);
+    ASSERT_EQ(3U, *pSeen[0]);
+    ASSERT_EQ(3U, *pSeen[3]);
+    ASSERT_EQ(true, Deque_IsFull(&q));
+
+    PASS();
+}
+
+TEST Deque_iterator_walks_back_to_front_in_place(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Iter_t it;
+    uint32_t buf[4];
+    uint32_t dataIn[] = { 10, 20, 30 };
+    uint32_t *pData;
+    uint32_t seen[4] = { 0 };
+    size_t count = 0;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_IterBeginBack(&q, &it);
+    while ((pData = Deque_IterPrev(&it)) != NULL)
+    {
+        seen[count++] = *pData;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(3U, count);
+    ASSERT_EQ(30U, seen[0]);
+    ASSERT_EQ(20U, seen[1]);
+    ASSERT_EQ(10U, seen[2]);
+
+    PASS();
+}
+
+TEST Deque_iterator_refuses_buffers_that_split_elements(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Iter_t it;
+    uint8_t buf[7];
+    uint16_t dataIn = 5;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(uint16_t));
+    Deque_PushBack(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_IterBegin(&q, &it);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+    ASSERT_EQ(NULL, Deque_IterNext(&it));
+
+    PASS();
+}
+
+typedef struct _Deque_Visit_Ctx_t
+{
+    uint16_t seen[8];
+    size_t   count;
+    size_t   limit;
+} Deque_Visit_Ctx_t;
+
+static bool Deque_Test_Visit(void *pCtx, void *pData)
+{
+    Deque_Visit_Ctx_t *pVisit = (Deque_Visit_Ctx_t *)pCtx;
+
+    pVisit->seen[pVisit->count++] = *(uint16_t *)pData;
+    return (pVisit->count < pVisit->limit);
+}
+
+static size_t Deque_Test_Drain(void *pCtx, void *pData, size_t count)
+{
+    Deque_Visit_Ctx_t *pVisit = (Deque_Visit_Ctx_t *)pCtx;
+    size_t taken = 0;
+
+    while ((taken < count) && (pVisit->count < pVisit->limit))
+    {
+        pVisit->seen[pVisit->count++] = ((uint16_t *)pData)[taken++];
+    }
+
+    return taken;
+}
+
+TEST Deque_for_each_visits_across_the_wrap_and_stops_when_asked(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[2];
+    Deque_Visit_Ctx_t all = { .limit = 8 };
+    Deque_Visit_Ctx_t some = { .limit = 2 };
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 2);
+
+    /*****************     Act       *****************/
+    size_t allVisited = Deque_ForEach(&q, Deque_Test_Visit, &all);
+    size_t someVisited = Deque_ForEach(&q, Deque_Test_Visit, &some);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3U, allVisited);
+    ASSERT_EQ(3U, all.seen[0]);
+    ASSERT_EQ(1U, all.seen[1]);
+    ASSERT_EQ(2U, all.seen[2]);
+    ASSERT_EQ(2U, someVisited);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFrontN(&q, dataOut, 2));
+    ASSERT_EQ(3U, dataOut[0]);
+
+    PASS();
+}
+
+TEST Deque_drain_front_consumes_both_runs_at_once(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t stats;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[2];
+    Deque_Visit_Ctx_t ctx = { .limit = 8 };
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 3);
+    Deque_AttachStats(&q, &stats);
+
+    /*****************     Act       *****************/
+    size_t drained = Deque_DrainFront(&q, Deque_Test_Drain, &ctx);
+    size_t drainedEmpty = Deque_DrainFront(&q, Deque_Test_Drain, &ctx);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(4U, drained);
+    ASSERT_EQ(0U, drainedEmpty);
+    ASSERT_EQ(3U, ctx.seen[0]);
+    ASSERT_EQ(1U, ctx.seen[1]);
+    ASSERT_EQ(2U, ctx.seen[2]);
+    ASSERT_EQ(3U, ctx.seen[3]);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+    Deque_GetStats(&q, &stats);
+    ASSERT_EQ(4U, stats.popFront);
+
+    PASS();
+}
+
+TEST Deque_drain_front_keeps_what_the_visitor_did_not_consume(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut;
+    Deque_Visit_Ctx_t ctx = { .limit = 3 };
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    size_t drained = Deque_DrainFront(&q, Deque_Test_Drain, &ctx);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3U, drained);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFront(&q, &dataOut));
+    ASSERT_EQ(4U, dataOut);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_dynamic_deque_grows_past_its_initial_size(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t dataOut[10];
+    Deque_InitDynamic(&q, &Deque_StdAllocator, 2, sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(Deque_Error_None, Deque_PushBack(&q, &i));
+    }
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        uint32_t val = 100 + i;
+        ASSERT_EQ(Deque_Error_None, Deque_PushFront(&q, &val));
+    }
+    Deque_Error_e err = Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(104U - i, dataOut[i]);
+        ASSERT_EQ(i, dataOut[5 + i]);
+    }
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    Deque_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_dynamic_deque_keeps_order_when_growing_from_a_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t dataIn[] = { 1, 2, 3 };
+    uint8_t dataOut[5];
+    Deque_InitDynamic(&q, &Deque_StdAllocator, 3, sizeof(uint8_t));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_PopFrontN(&q, dataOut, 2);
+    Deque_PushBackN(&q, dataIn, 2);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PushBackN(&q, dataIn, 2);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(6U, q.bufSize);
+    ASSERT_EQ(Deque_Error_None,
+              Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut)));
+    ASSERT_EQ(3U, dataOut[0]);
+    ASSERT_EQ(1U, dataOut[1]);
+    ASSERT_EQ(2U, dataOut[2]);
+    ASSERT_EQ(1U, dataOut[3]);
+    ASSERT_EQ(2U, dataOut[4]);
+
+    Deque_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_dynamic_deque_shrinks_back_to_its_initial_size(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint16_t dataIn[16] = { 0 };
+    uint16_t dataOut;
+    Deque_InitDynamic(&q, &Deque_StdAllocator, 4, sizeof(uint16_t));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    size_t grownSize = q.bufSize;
+    while (Deque_PopBack(&q, &dataOut) == Deque_Error_None)
+    {
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(16U * sizeof(uint16_t), grownSize);
+    ASSERT_EQ(4U * sizeof(uint16_t), q.bufSize);
+    ASSERT_EQ(q.bufSize - 1, q.mask);
+
+    Deque_Deinit(&q);
+    PASS();
+}
+
+TEST Deque_dynamic_deque_uses_the_given_allocator(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_TestAllocStats_t stats = { 0 };
+    Deque_Allocator_t alloc =
+    {
+        .pfnAlloc = Deque_TestAlloc,
+        .pfnRealloc = NULL,
+        .pfnFree = Deque_TestFree,
+        .pCtx = &stats,
+    };
+    uint8_t dataIn[] = { 1, 2, 3, 4, 5 };
+    Deque_InitDynamic(&q, &alloc, 2, sizeof(uint8_t));
+
+    /*****************     Act       *****************/
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    size_t liveWhileGrown = stats.live;
+    Deque_Deinit(&q);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(8U, liveWhileGrown);
+    ASSERT_EQ(0U, stats.live);
+    ASSERT_EQ(stats.allocs, stats.frees);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_mirrored_buffer_aliases_its_second_half(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    ASSERT_EQ(Deque_Error_None, Deque_InitMirrored(&q, 1, sizeof(uint32_t)));
+
+    /*****************     Act       *****************/
+    q.pBuf[3] = 0xA5;
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0xA5U, q.pBuf[q.bufSize + 3]);
+    ASSERT_EQ(0U, q.bufSize % sizeof(uint32_t));
+
+    Deque_DeinitMirrored(&q);
+    PASS();
+}
+
+TEST Deque_mirrored_deque_hands_out_one_span_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Span_t spans[2];
+    Deque_InitMirrored(&q, 1, sizeof(uint32_t));
+    size_t slots = q.bufSize / sizeof(uint32_t);
+    uint32_t *pDataIn = malloc(q.bufSize);
+    uint32_t *pDataOut = malloc(q.bufSize);
+    for (size_t i = 0; i < slots; i++)
+    {
+        pDataIn[i] = (uint32_t)i;
+    }
+    Deque_PushBackN(&q, pDataIn, slots - 2);
+    Deque_PopFrontN(&q, pDataOut, slots - 4);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_PushBackN(&q, pDataIn, 6);
+    Deque_PeekFrontSpans(&q, spans);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(8U, spans[0].count);
+    ASSERT_EQ(0U, spans[1].count);
+    ASSERT_EQ(slots - 4, ((uint32_t *)spans[0].pData)[0]);
+    ASSERT_EQ(5U, ((uint32_t *)spans[0].pData)[7]);
+    Deque_PeekBackSpans(&q, spans);
+    ASSERT_EQ(8U, spans[0].count);
+    ASSERT_EQ(0U, spans[1].count);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFrontN(&q, pDataOut, 8));
+    ASSERT_EQ(slots - 3, pDataOut[1]);
+    ASSERT_EQ(0U, pDataOut[2]);
+
+    free(pDataIn);
+    free(pDataOut);
+    Deque_DeinitMirrored(&q);
+    PASS();
+}
+
+TEST Deque_mirrored_reservation_covers_all_free_space(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    void *pDataIn;
+    size_t count;
+    uint8_t dataOut;
+    Deque_InitMirrored(&q, 1, sizeof(uint8_t));
+    q.front = q.bufSize - 2;
+    q.rear = q.bufSize - 1;
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_ReserveBack(&q, SIZE_MAX, &pDataIn, &count);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(q.bufSize - 1, count);
+    ((uint8_t *)pDataIn)[0] = 1;
+    ((uint8_t *)pDataIn)[1] = 2;
+    ASSERT_EQ(Deque_Error_None, Deque_CommitBack(&q, 2));
+    ASSERT_EQ(Deque_Error_None, Deque_PopBack(&q, &dataOut));
+    ASSERT_EQ(2U, dataOut);
+    ASSERT_EQ(0U, q.rear);
+
+    Deque_DeinitMirrored(&q);
+    PASS();
+}
+
+TEST Deque_overwrite_mode_keeps_the_newest_elements(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t counters;
+    Deque_Stats_t stats;
+    uint16_t buf[3];
+    uint16_t dataOut[3];
+    uint8_t err = (uint8_t)Deque_Error_None;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_SetOverwrite(&q, true);
+    Deque_AttachStats(&q, &counters);
+
+    /*****************     Act       *****************/
+    for (uint16_t i = 1; i <= 7; i++)
+    {
+        err |= Deque_PushBack(&q, &i);
+    }
+    Deque_GetStats(&q, &stats);
+    err |= Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(5U, dataOut[0]);
+    ASSERT_EQ(6U, dataOut[1]);
+    ASSERT_EQ(7U, dataOut[2]);
+    ASSERT_EQ(7U, stats.pushBack);
+    ASSERT_EQ(4U, stats.popFront);
+    ASSERT_EQ(0U, stats.pushFails);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_push_back_overwrite_hands_back_the_evicted_element(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t buf[2];
+    uint32_t dataIn[] = { 1, 2, 3 };
+    uint32_t evicted = 0;
+    uint32_t dataOut;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    bool evicted1 = Deque_PushBackOverwrite(&q, &dataIn[0], &evicted);
+    bool evicted2 = Deque_PushBackOverwrite(&q, &dataIn[1], &evicted);
+    bool evicted3 = Deque_PushBackOverwrite(&q, &dataIn[2], &evicted);
+    Deque_Error_e pushErr = Deque_PushBack(&q, &dataIn[0]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(false, evicted1);
+    ASSERT_EQ(false, evicted2);
+    ASSERT_EQ(true, evicted3);
+    ASSERT_EQ(1U, evicted);
+    ASSERT_EQ(Deque_Error, pushErr);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFront(&q, &dataOut));
+    ASSERT_EQ(2U, dataOut);
+    ASSERT_EQ(Deque_Error_None, Deque_PopFront(&q, &dataOut));
+    ASSERT_EQ(3U, dataOut);
+
+    PASS();
+}
+
+TEST Deque_overwrite_mode_is_ignored_by_dynamic_deques(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t dataOut[4];
+    uint8_t err = (uint8_t)Deque_Error_None;
+    Deque_InitDynamic(&q, &Deque_StdAllocator, 2, sizeof(uint32_t));
+    Deque_SetOverwrite(&q, true);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        err |= Deque_PushBack(&q, &i);
+    }
+    err |= Deque_PopFrontN(&q, dataOut, ELEMENTS_IN(dataOut));
+    Deque_Deinit(&q);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(0U, dataOut[0]);
+    ASSERT_EQ(3U, dataOut[3]);
+
+    PASS();
+}
+
+TEST Deque_stats_count_pushes_pops_and_failures_per_end(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t stats;
+    Deque_Stats_t copy;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3 };
+    uint8_t dataOut[3];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_AttachStats(&q, &stats);
+
+    /*****************     Act       *****************/
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+    Deque_PushFront(&q, dataIn);
+    Deque_PushBack(&q, dataIn);
+    Deque_PopBack(&q, dataOut);
+    Deque_PopFrontN(&q, dataOut, 3);
+    Deque_PopFront(&q, dataOut);
+    Deque_Error_e err = Deque_GetStats(&q, &copy);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(1U, copy.pushFront);
+    ASSERT_EQ(3U, copy.pushBack);
+    ASSERT_EQ(3U, copy.popFront);
+    ASSERT_EQ(1U, copy.popBack);
+    ASSERT_EQ(1U, copy.pushFails);
+    ASSERT_EQ(1U, copy.popFails);
+    ASSERT_EQ(4U, copy.highWater);
+
+    PASS();
+}
+
+TEST Deque_stats_count_zero_copy_commits_and_releases(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t stats;
+    uint16_t buf[8];
+    void *pDataIn;
+    size_t count;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_AttachStats(&q, &stats);
+
+    /*****************     Act       *****************/
+    Deque_ReserveBack(&q, 5, &pDataIn, &count);
+    Deque_CommitBack(&q, count);
+    Deque_ReleaseFront(&q, 2);
+    Deque_ReleaseBack(&q, 4);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(5U, stats.pushBack);
+    ASSERT_EQ(2U, stats.popFront);
+    ASSERT_EQ(0U, stats.popBack);
+    ASSERT_EQ(1U, stats.popFails);
+    ASSERT_EQ(5U, stats.highWater);
+
+    PASS();
+}
+
+TEST Deque_stats_count_reserves_refused_when_full(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t stats;
+    uint16_t buf[2];
+    uint16_t dataIn[] = { 1, 2 };
+    void *pDataIn;
+    size_t count;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_AttachStats(&q, &stats);
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e backErr = Deque_ReserveBack(&q, 1, &pDataIn, &count);
+    Deque_Error_e frontErr = Deque_ReserveFront(&q, 1, &pDataIn, &count);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(2U, stats.pushFails);
+    ASSERT_EQ(2U, stats.pushBack);
+    ASSERT_EQ(0U, stats.pushFront);
+
+    PASS();
+}
+
+TEST Deque_get_stats_fails_without_attached_counters(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    Deque_Stats_t stats;
+    uint8_t buf[2];
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = Deque_GetStats(&q, &stats);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_peek_fails_if_empty(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[2];
+    uint8_t dataOut;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = Deque_PeekFront(&q, &dataOut);
+    Deque_Error_e backErr = Deque_PeekBack(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error, backErr);
+    ASSERT_EQ(true, Deque_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_can_peek_at_any_index_across_the_buffer_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint32_t buf[5];
+    uint32_t dataIn[] = { 10, 20, 30, 40, 50 };
+    uint32_t scratch[3];
+    uint32_t atFront[5] = { 0 };
+    uint32_t atBack[5] = { 0 };
+    uint32_t expectedBack[] = { 50, 40, 30, 20, 10 };
+    uint8_t err = (uint8_t)Deque_Error_None;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, scratch, ELEMENTS_IN(scratch));
+    Deque_PopFrontN(&q, scratch, ELEMENTS_IN(scratch));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        err |= Deque_PeekAt(&q, i, &atFront[i]);
+        err |= Deque_PeekAtBack(&q, i, &atBack[i]);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_MEM_EQ(dataIn, atFront, sizeof(dataIn));
+    ASSERT_MEM_EQ(expectedBack, atBack, sizeof(expectedBack));
+    ASSERT_EQ(true, Deque_IsFull(&q));
+
+    PASS();
+}
+
+TEST Deque_peek_at_fails_past_the_last_element(void)
+{
+    /*****************    Arrange    *****************/
+    Deque_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2 };
+    uint8_t dataOut;
+    Deque_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Deque_PushBackN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    Deque_Error_e frontErr = Deque_PeekAt(&q, 2, &dataOut);
+    Deque_Error_e backErr = Deque_PeekAtBack(&q, SIZE_MAX, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, frontErr);
+    ASSERT_EQ(Deque_Error, backErr);
+
+    PASS();
+}
+
 SUITE(Deque_Suite)
 {
     /* Unit Tests */
@@ -1296,6 +2356,7 @@ SUITE(Deque_Suite)
 
     RUN_TEST(Deque_can_front_pop_1_byte_data_types_when_pushed_from_back);
     RUN_TEST(Deque_can_front_pop_2_byte_data_types_when_pushed_from_back);
+    RUN_TEST(Deque_can_front_pop_4_byte_data_types_when_pushed_from_back);
     RUN_TEST(Deque_can_front_pop_8_byte_data_types_when_pushed_from_back);
     RUN_TEST(Deque_can_front_pop_struct_data_types_when_pushed_from_back);
 
@@ -1318,6 +2379,53 @@ SUITE(Deque_Suite)
     RUN_TEST(Deque_can_peek_at_next_element_to_be_front_popped_when_pushed_from_front);
     RUN_TEST(Deque_can_peek_at_next_element_to_be_back_popped_when_pushed_from_back);
     RUN_TEST(Deque_can_peek_at_next_element_to_be_back_popped_when_pushed_from_front);
+    RUN_TEST(Deque_peek_fails_if_empty);
+    RUN_TEST(Deque_can_peek_at_any_index_across_the_buffer_wrap);
+    RUN_TEST(Deque_peek_at_fails_past_the_last_element);
+
+    RUN_TEST(Deque_can_push_back_n_and_pop_front_n_across_the_buffer_wrap);
+    RUN_TEST(Deque_can_push_front_n_and_pop_back_n_across_the_buffer_wrap);
+    RUN_TEST(Deque_bulk_push_keeps_element_order_for_single_pops);
+    RUN_TEST(Deque_bulk_push_fails_without_room_for_every_element);
+    RUN_TEST(Deque_bulk_pop_fails_without_enough_elements);
+
+    RUN_TEST(Deque_power_of_two_init_rejects_other_buffer_sizes);
+    RUN_TEST(Deque_power_of_two_buffer_wraps_at_both_ends);
+
+    RUN_TEST(Deque_can_reserve_and_commit_at_the_back);
+    RUN_TEST(Deque_back_reservation_stops_at_the_buffer_wrap);
+    RUN_TEST(Deque_reserve_fails_when_full);
+    RUN_TEST(Deque_can_reserve_and_commit_at_the_front);
+
+    RUN_TEST(Deque_front_spans_split_at_the_buffer_wrap);
+    RUN_TEST(Deque_back_spans_start_with_the_run_ending_at_the_rear);
+    RUN_TEST(Deque_spans_are_empty_when_the_deque_is_empty);
+    RUN_TEST(Deque_can_release_data_from_both_ends);
+
+    RUN_TEST(Deque_iterator_walks_front_to_back_in_place_across_the_wrap);
+    RUN_TEST(Deque_iterator_walks_back_to_front_in_place);
+    RUN_TEST(Deque_iterator_refuses_buffers_that_split_elements);
+    RUN_TEST(Deque_for_each_visits_across_the_wrap_and_stops_when_asked);
+    RUN_TEST(Deque_drain_front_consumes_both_runs_at_once);
+    RUN_TEST(Deque_drain_front_keeps_what_the_visitor_did_not_consume);
+
+    RUN_TEST(Deque_dynamic_deque_grows_past_its_initial_size);
+    RUN_TEST(Deque_dynamic_deque_keeps_order_when_growing_from_a_wrap);
+    RUN_TEST(Deque_dynamic_deque_shrinks_back_to_its_initial_size);
+    RUN_TEST(Deque_dynamic_deque_uses_the_given_allocator);
+
+    RUN_TEST(Deque_mirrored_buffer_aliases_its_second_half);
+    RUN_TEST(Deque_mirrored_deque_hands_out_one_span_across_the_wrap);
+    RUN_TEST(Deque_mirrored_reservation_covers_all_free_space);
+
+    RUN_TEST(Deque_overwrite_mode_keeps_the_newest_elements);
+    RUN_TEST(Deque_push_back_overwrite_hands_back_the_evicted_element);
+    RUN_TEST(Deque_overwrite_mode_is_ignored_by_dynamic_deques);
+
+    RUN_TEST(Deque_stats_count_pushes_pops_and_failures_per_end);
+    RUN_TEST(Deque_stats_count_zero_copy_commits_and_releases);
+    RUN_TEST(Deque_stats_count_reserves_refused_when_full);
+    RUN_TEST(Deque_get_stats_fails_without_attached_counters);
 
     /* Integration Tests */
     RUN_TEST(Deque_can_empty_a_full_buffer_of_1_byte_data_types_by_push_back_and_pop_front);
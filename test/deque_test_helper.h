@@ -5,4 +5,30 @@
 
 #define ELEMENTS_IN(array)    ( sizeof(array) / sizeof(array[0]) )
 
+/* Allocation hooks that count what passes through them */
+typedef struct
+{
+    size_t allocs;
+    size_t frees;
+    size_t live;
+} Deque_TestAllocStats_t;
+
+static void *Deque_TestAlloc(void *pCtx, size_t size)
+{
+    Deque_TestAllocStats_t *pStats = (Deque_TestAllocStats_t *)pCtx;
+
+    pStats->allocs++;
+    pStats->live += size;
+    return malloc(size);
+}
+
+static void Deque_TestFree(void *pCtx, void *pMem, size_t size)
+{
+    Deque_TestAllocStats_t *pStats = (Deque_TestAllocStats_t *)pCtx;
+
+    pStats->frees++;
+    pStats->live -= size;
+    free(pMem);
+}
+
 #endif /* DEQUE_TEST_HELPER_H_INCLUDED */
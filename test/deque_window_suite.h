@@ -0,0 +1,138 @@
+#ifndef DEQUE_WINDOW_SUITE_INCLUDED
+#define DEQUE_WINDOW_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_window.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Window_Suite);
+
+#define WINDOW_SAMPLES    1000U
+
+static int Deque_Window_Ascending(const void *pA, const void *pB)
+{
+    int32_t a = *(const int32_t *)pA;
+    int32_t b = *(const int32_t *)pB;
+
+    return (a > b) - (a < b);
+}
+
+static int Deque_Window_Descending(const void *pA, const void *pB)
+{
+    return Deque_Window_Ascending(pB, pA);
+}
+
+TEST Deque_window_init_rejects_a_short_buffer_or_empty_window(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWindow_t w;
+    uint64_t buf[DEQUE_WINDOW_BUF_SIZE(4, sizeof(int32_t)) / sizeof(uint64_t)];
+
+    /*****************     Act       *****************/
+    Deque_Error_e shortErr = DequeWindow_Init(&w, buf, sizeof(buf), 5,
+                                              sizeof(int32_t),
+                                              Deque_Window_Ascending);
+    Deque_Error_e emptyErr = DequeWindow_Init(&w, buf, sizeof(buf), 0,
+                                              sizeof(int32_t),
+                                              Deque_Window_Ascending);
+    Deque_Error_e okErr = DequeWindow_Init(&w, buf, sizeof(buf), 4,
+                                           sizeof(int32_t),
+                                           Deque_Window_Ascending);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, shortErr);
+    ASSERT_EQ(Deque_Error, emptyErr);
+    ASSERT_EQ(Deque_Error_None, okErr);
+
+    PASS();
+}
+
+TEST Deque_window_get_fails_before_the_first_sample(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWindow_t w;
+    uint64_t buf[DEQUE_WINDOW_BUF_SIZE(2, sizeof(int32_t)) / sizeof(uint64_t)];
+    int32_t dataIn = -3;
+    int32_t dataOut = 0;
+    DequeWindow_Init(&w, buf, sizeof(buf), 2, sizeof(int32_t),
+                     Deque_Window_Ascending);
+
+    /*****************     Act       *****************/
+    Deque_Error_e emptyErr = DequeWindow_Get(&w, &dataOut);
+    DequeWindow_Push(&w, &dataIn);
+    Deque_Error_e err = DequeWindow_Get(&w, &dataOut);
+    DequeWindow_Reset(&w);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, emptyErr);
+    ASSERT_EQ(Deque_Error_None, err);
+    ASSERT_EQ(-3, dataOut);
+    ASSERT_EQ(Deque_Error, DequeWindow_Get(&w, &dataOut));
+
+    PASS();
+}
+
+TEST Deque_window_tracks_the_min_and_max_of_a_rescan(void)
+{
+    /*****************    Arrange    *****************/
+    enum { WINDOW = 7 };
+    DequeWindow_t minW;
+    DequeWindow_t maxW;
+    uint64_t minBuf[DEQUE_WINDOW_BUF_SIZE(WINDOW, sizeof(int32_t)) /
+                    sizeof(uint64_t)];
+    uint64_t maxBuf[ELEMENTS_IN(minBuf)];
+    static int32_t samples[WINDOW_SAMPLES];
+    uint32_t mismatches = 0;
+    uint32_t rng = 12345;
+    DequeWindow_Init(&minW, minBuf, sizeof(minBuf), WINDOW, sizeof(int32_t),
+                     Deque_Window_Ascending);
+    DequeWindow_Init(&maxW, maxBuf, sizeof(maxBuf), WINDOW, sizeof(int32_t),
+                     Deque_Window_Descending);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < WINDOW_SAMPLES; i++)
+    {
+        int32_t gotMin;
+        int32_t gotMax;
+        int32_t wantMin;
+        int32_t wantMax;
+        uint32_t first = (i >= WINDOW) ? (i - WINDOW + 1) : 0;
+
+        /* Small range so ties are common */
+        rng = (rng * 1103515245U) + 12345U;
+        samples[i] = (int32_t)((rng >> 16) % 21U) - 10;
+        DequeWindow_Push(&minW, &samples[i]);
+        DequeWindow_Push(&maxW, &samples[i]);
+        DequeWindow_Get(&minW, &gotMin);
+        DequeWindow_Get(&maxW, &gotMax);
+
+        wantMin = samples[first];
+        wantMax = samples[first];
+        for (uint32_t j = first; j <= i; j++)
+        {
+            wantMin = (samples[j] < wantMin) ? samples[j] : wantMin;
+            wantMax = (samples[j] > wantMax) ? samples[j] : wantMax;
+        }
+
+        mismatches += (gotMin != wantMin) + (gotMax != wantMax);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0U, mismatches);
+
+    PASS();
+}
+
+SUITE(Deque_Window_Suite)
+{
+    RUN_TEST(Deque_window_init_rejects_a_short_buffer_or_empty_window);
+    RUN_TEST(Deque_window_get_fails_before_the_first_sample);
+    RUN_TEST(Deque_window_tracks_the_min_and_max_of_a_rescan);
+}
+
+#endif /* DEQUE_WINDOW_SUITE_INCLUDED */
@@ -0,0 +1,208 @@
+#ifndef DEQUE_WS_SUITE_INCLUDED
+#define DEQUE_WS_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "deque_test_helper.h"
+#include "deque_ws.h"
+
+/* Declare a local suite. */
+SUITE(Deque_Ws_Suite);
+
+#define WS_THIEVES     3U
+#define WS_ELEMENTS    50000U
+
+typedef struct _Deque_Ws_Thief_t
+{
+    DequeWs_t  *pQ;
+    atomic_bool *pDone;
+    uint64_t    sum;
+    uint32_t    count;
+} Deque_Ws_Thief_t;
+
+static void *Deque_Ws_Thief(void *pArg)
+{
+    Deque_Ws_Thief_t *pThief = (Deque_Ws_Thief_t *)pArg;
+    uint32_t dataOut;
+
+    while (!atomic_load(pThief->pDone) || !DequeWs_IsEmpty(pThief->pQ))
+    {
+        if (DequeWs_StealBack(pThief->pQ, &dataOut) == Deque_Error_None)
+        {
+            pThief->sum += dataOut;
+            pThief->count++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+TEST Deque_ws_init_rejects_non_power_of_two_capacity(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWs_t q;
+    uint8_t buf[3];
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeWs_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_ws_owner_pops_in_stack_order(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWs_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4 };
+    uint16_t dataOut[4] = { 0 };
+    uint16_t expected[] = { 4, 3, 2, 1 };
+    uint8_t err = (uint8_t)Deque_Error_None;
+    DequeWs_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        err |= DequeWs_PushFront(&q, &dataIn[i]);
+    }
+    Deque_Error_e overErr = DequeWs_PushFront(&q, &dataIn[0]);
+
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataOut); i++)
+    {
+        err |= DequeWs_PopFront(&q, &dataOut[i]);
+    }
+    Deque_Error_e underErr = DequeWs_PopFront(&q, &dataOut[0]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, (Deque_Error_e)err);
+    ASSERT_EQ(Deque_Error, overErr);
+    ASSERT_EQ(Deque_Error, underErr);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, DequeWs_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Deque_ws_thief_steals_the_oldest_element(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWs_t q;
+    uint32_t buf[4];
+    uint32_t dataIn[] = { 10, 20, 30 };
+    uint32_t stolen = 0;
+    uint32_t popped = 0;
+    DequeWs_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    for (uint8_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        DequeWs_PushFront(&q, &dataIn[i]);
+    }
+
+    /*****************     Act       *****************/
+    Deque_Error_e stealErr = DequeWs_StealBack(&q, &stolen);
+    Deque_Error_e popErr = DequeWs_PopFront(&q, &popped);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error_None, stealErr);
+    ASSERT_EQ(Deque_Error_None, popErr);
+    ASSERT_EQ(10U, stolen);
+    ASSERT_EQ(30U, popped);
+
+    PASS();
+}
+
+TEST Deque_ws_steal_fails_if_empty(void)
+{
+    /*****************    Arrange    *****************/
+    DequeWs_t q;
+    uint32_t buf[4];
+    uint32_t dataIn = 1;
+    uint32_t dataOut;
+    DequeWs_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    DequeWs_PushFront(&q, &dataIn);
+    DequeWs_PopFront(&q, &dataOut);
+
+    /*****************     Act       *****************/
+    Deque_Error_e err = DequeWs_StealBack(&q, &dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Deque_Error, err);
+
+    PASS();
+}
+
+TEST Deque_ws_hands_out_every_element_exactly_once_under_stealing(void)
+{
+    /*****************    Arrange    *****************/
+    static DequeWs_t q;
+    static uint32_t buf[256];
+    atomic_bool done = false;
+    Deque_Ws_Thief_t thieves[WS_THIEVES];
+    pthread_t threads[WS_THIEVES];
+    uint64_t expectedSum = ((uint64_t)WS_ELEMENTS * (WS_ELEMENTS + 1)) / 2;
+    uint64_t sum = 0;
+    uint32_t count = 0;
+    uint32_t dataOut;
+    DequeWs_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    for (uint32_t i = 0; i < WS_THIEVES; i++)
+    {
+        thieves[i] = (Deque_Ws_Thief_t){ .pQ = &q, .pDone = &done };
+        pthread_create(&threads[i], NULL, Deque_Ws_Thief, &thieves[i]);
+    }
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 1; i <= WS_ELEMENTS; i++)
+    {
+        while (DequeWs_PushFront(&q, &i) != Deque_Error_None)
+        {
+            sched_yield();
+        }
+
+        /* Take back every other element as the owner */
+        if (((i & 1U) == 0U) &&
+            (DequeWs_PopFront(&q, &dataOut) == Deque_Error_None))
+        {
+            sum += dataOut;
+            count++;
+        }
+    }
+
+    atomic_store(&done, true);
+
+    for (uint32_t i = 0; i < WS_THIEVES; i++)
+    {
+        pthread_join(threads[i], NULL);
+        sum += thieves[i].sum;
+        count += thieves[i].count;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(WS_ELEMENTS, count);
+    ASSERT_EQ(expectedSum, sum);
+
+    PASS();
+}
+
+SUITE(Deque_Ws_Suite)
+{
+    RUN_TEST(Deque_ws_init_rejects_non_power_of_two_capacity);
+    RUN_TEST(Deque_ws_owner_pops_in_stack_order);
+    RUN_TEST(Deque_ws_thief_steals_the_oldest_element);
+    RUN_TEST(Deque_ws_steal_fails_if_empty);
+    RUN_TEST(Deque_ws_hands_out_every_element_exactly_once_under_stealing);
+}
+
+#endif /* DEQUE_WS_SUITE_INCLUDED */
@@ -10,6 +10,17 @@
 #include "greatest.h"
 
 #include "deque_suite.h"
+#include "deque_define_suite.h"
+#include "deque_spsc_suite.h"
+#include "deque_mpmc_suite.h"
+#include "deque_ws_suite.h"
+#include "deque_exec_suite.h"
+#include "deque_seg_suite.h"
+#include "deque_pool_suite.h"
+#include "deque_persist_suite.h"
+#include "deque_instr_suite.h"
+#include "deque_prio_suite.h"
+#include "deque_window_suite.h"
 
 GREATEST_MAIN_DEFS();
 
@@ -20,6 +31,17 @@ int main(int argc, char **argv)
     printf("\n*********          Begin Unit Tests          *********\n");
 
     RUN_SUITE(Deque_Suite);
+    RUN_SUITE(Deque_Define_Suite);
+    RUN_SUITE(Deque_Spsc_Suite);
+    RUN_SUITE(Deque_Mpmc_Suite);
+    RUN_SUITE(Deque_Ws_Suite);
+    RUN_SUITE(Deque_Exec_Suite);
+    RUN_SUITE(Deque_Seg_Suite);
+    RUN_SUITE(Deque_Pool_Suite);
+    RUN_SUITE(Deque_Persist_Suite);
+    RUN_SUITE(Deque_Instr_Suite);
+    RUN_SUITE(Deque_Prio_Suite);
+    RUN_SUITE(Deque_Window_Suite);
 
     printf("\n*********          End Unit Tests            *********\n");
 